@@ -56,7 +56,8 @@ struct Cascade
 inline double GammaGammaTF1(double *x, double *par)
 {
     std::vector<double> parv = {par[0], par[1], par[2]};
-    return par[3] * GammaGammaW(cos(x[0] * M_PI / 180.), parv) / GammaGammaW(cos(90. * M_PI / 180.), parv);
+    // events are distributed as W(cos(theta)) dOmega, so the theta histogram follows W * sin(theta)
+    return par[3] * GammaGammaW(cos(x[0] * M_PI / 180.), parv) * sin(x[0] * M_PI / 180.) / GammaGammaW(cos(90. * M_PI / 180.), parv);
 }
 
 int main(int argc, char *argv[])
@@ -147,9 +148,6 @@ int main(int argc, char *argv[])
 
         // ak
         std::vector<double> ak = correlation::CaluclateGammaCoefficient_a(std::abs(Ji), std::abs(Jm), std::abs(Jf), L1, delta1, L2, delta2);
-        double W_max = correlation::MaxAnalyticalGammaCorrelation(ak);
-        std::vector<std::vector<double>> *dist = new std::vector<std::vector<double>>();
-        dist->push_back(ak);
         Info("ak coefficients : ", 1);
         for (size_t i = 0; i < ak.size(); i++)        {
             Info(Form("a%d : %.4f", (int)i, ak[i]), 2);
@@ -157,6 +155,16 @@ int main(int argc, char *argv[])
 
         Particle *Initstate = new Particle(1000180320, GetApproximateMass(18, 32), 18, 14, Ji, Ei);
         dm.RegisterParticle(Initstate);
+
+        // Fictive level scheme holding the cascade
+        GammaCascadeTable cascadeTable;
+        cascadeTable.AddLevel(Ei, Ji);
+        cascadeTable.AddLevel(Em, Jm);
+        cascadeTable.AddLevel(Ef, Jf);
+        cascadeTable.AddTransition(Ei, Em, L1, delta1);
+        cascadeTable.AddTransition(Em, Ef, L2, delta2);
+        cascadeTable.Build();
+        dm.RegisterGammaCascadeTable(1000180320, cascadeTable);
     
         std::ostringstream oss_saved;
 
@@ -170,10 +178,6 @@ int main(int argc, char *argv[])
             std::vector<Particle *> mstate = (&dm.GetDecayMode("Gamma"))->Decay(initstate, Ei - Em, Em);
             Particle *GAMMA1 = mstate.at(1); // first gamma
 
-            std::ostringstream oss;
-            oss << "GammaGamma:" << "Z" << initstate->GetCharge() << "A" << initstate->GetCharge() + initstate->GetNeutrons() << "Ei" << Em + GAMMA1->GetKinEnergy() << "Em" << Em << "Ef" << Ef;
-            dm.RegisterChannelPropreties(oss.str(), dist, W_max, Ji, Jf, Jm);
-
             // avoid Doppler Broadering
             ublas::vector<double> m(4, 0);
             m(0) = mstate.at(0)->GetMass();
@@ -0,0 +1,38 @@
+### Python macro to read the .cev event file generated by CRADLE++ with numpy memmap ###
+### (layout described in include/CRADLE/EventFile.hh)                              ###
+
+import sys
+import numpy as np
+
+header_dtype = np.dtype([("magic", "S8"), ("version", "<u4"), ("header_size", "<u4"),
+                         ("config_hash", "<u8"), ("seed", "<u8"), ("n_events", "<u8"), ("n_chunks", "<u8"),
+                         ("chunk_index_offset", "<u8"), ("pdg_table_offset", "<u8"),
+                         ("n_codes", "<u4"), ("reserved0", "<u4"), ("branching_ratio", "<f8"),
+                         ("reserved", "<u8", 6)])
+chunk_dtype = np.dtype([("first_event", "<u8"), ("n_events", "<u4"), ("n_particles", "<u4")])
+particle_dtype = np.dtype([("code", "<i4"), ("weight", "<f4"), ("time", "<f8"), ("excitation_energy", "<f8"),
+                           ("energy", "<f8"), ("p", "<f8"), ("px", "<f8"), ("py", "<f8"), ("pz", "<f8")])
+
+
+def read_cev(file_name):
+    """Yield (first_event, offsets, particles) for each chunk, all views on the mapped file"""
+    data = np.memmap(file_name, dtype=np.uint8, mode="r")
+    header = data[:header_dtype.itemsize].view(header_dtype)[0]
+    if header["magic"] != b"CRADLEEV" or header["chunk_index_offset"] == 0:
+        raise ValueError(file_name + " is not a complete CRADLE event file")
+    chunk_offsets = data[header["chunk_index_offset"]:header["chunk_index_offset"] + 8 * header["n_chunks"]].view("<u8")
+    for offset in chunk_offsets:
+        chunk = data[offset:offset + chunk_dtype.itemsize].view(chunk_dtype)[0]
+        n_events, n_particles = int(chunk["n_events"]), int(chunk["n_particles"])
+        offsets_start = offset + chunk_dtype.itemsize
+        offsets = data[offsets_start:offsets_start + 4 * (n_events + 1)].view("<u4")
+        particles_start = offset + (chunk_dtype.itemsize + 4 * (n_events + 1) + 63) // 64 * 64
+        particles = data[particles_start:particles_start + particle_dtype.itemsize * n_particles].view(particle_dtype)
+        yield int(chunk["first_event"]), offsets, particles
+
+
+if __name__ == "__main__":
+    n_particles = 0
+    for first_event, offsets, particles in read_cev(sys.argv[1]):
+        n_particles += len(particles)
+    print("Number of particles: %d" % n_particles)
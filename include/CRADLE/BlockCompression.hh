@@ -0,0 +1,23 @@
+#ifndef BLOCKCOMPRESSION
+#define BLOCKCOMPRESSION
+
+#include <string>
+
+namespace CRADLE {
+
+// Compression of independent output blocks. Each block becomes a complete gzip member
+// or zstd frame, so blocks compressed in parallel can be concatenated in one file
+// that gzip/zcat or zstd read as a single stream.
+namespace compression {
+
+    enum class Format { None, Gzip, Zstd };
+
+    // Format deduced from the end of the output name (.gz or .zst)
+    Format GetFormat(const std::string&);
+    bool IsAvailable(Format);
+    // Replaces the content of the block by its compressed version
+    bool CompressBlock(Format, std::string&, int level = -1);
+}
+
+}//End of CRADLE namespace
+#endif
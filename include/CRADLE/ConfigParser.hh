@@ -5,6 +5,7 @@
 #include "CRADLE/Messenger.hh"
 #include <string>
 #include <complex>
+#include <vector>
 
 namespace CRADLE {
 
@@ -27,6 +28,14 @@ struct General {
   int Loop = 0;
   int Threads = 5;
   std::string Output = "output.txt";
+  std::string Layout = "Vector";
+  std::string OutputPrecision = "Full";
+  std::string Compression = "Default";
+  int CompressionLevel = 5;
+  int BasketSize = 32000;
+  long long AutoFlush = -20 * 1024 * 1024;
+  std::string StreamFormat = "TXT";
+  int OutputDescriptor = -1; // stdout kept for the events when Output is "-", set by ParseOptions
 };
 
 struct CouplingConstants {
@@ -57,15 +66,32 @@ struct CouplingConstants {
 };
 
 struct Cuts {
-  double Distance = 1.E10;
-  double Lifetime = 1.E10;
-  double Energy = 1.E10;
+  double Distance = 1.E10; // m
+  double Lifetime = 1.E10; // s
+  double Energy = 1.E10; // keV
+};
+
+struct Filter {
+  std::vector<std::string> Particles; // selected particles, "all" for any particle, empty: no filter
+  double EnergyMin = 0.; // keV
+  double EnergyMax = 1.E10;
+  double TimeMin = 0.; // s
+  double TimeMax = 1.E10;
+  double DirectionX = 0.;
+  double DirectionY = 0.;
+  double DirectionZ = 1.;
+  double ConeAngle = 180.; // deg, half angle around the direction
+};
+
+struct Histograms {
+  std::vector<std::string> Histogram; // variable:particle:bins:min:max[:cut], see README
 };
 
 struct BetaDecay {
   std::string Default = "Auto";
   std::string FermiFunction = "Advanced";   
   bool BetaSpectrumCorrections = true;
+  std::string SpectrumCorrections = ""; // e.g. "F,L0,C,R", overrides BetaSpectrumCorrections if set
   bool RadiativeCorrections = true;
   double Cs = 1e-3;
 };
@@ -74,6 +100,8 @@ struct Decay{
   bool InFlightDecay = true;
   bool NuclearLevelWidth = true;
   bool GammaGammaCorrelation = true;
+  std::vector<std::string> Bias; // [mode:][nucleus:level:]factor, see README
+  std::vector<std::string> ForcePath; // steps mode:nucleus:level from the initial state
 };
 
 struct EnvOptions {
@@ -91,6 +119,8 @@ struct ConfigOptions{
   BetaDecay betaDecay;
   Decay decay;
   EnvOptions envOptions;
+  Histograms histograms;
+  Filter filter;
 };
 
 ConfigOptions ParseOptions(std::string, int argc = 0, const char** argv = nullptr);
@@ -98,7 +128,9 @@ ConfigOptions ParseOptions(std::string, int argc = 0, const char** argv = nullpt
 void SetGeneralOptions(CLI::App&, General&);
 void SetNuclearOptions(CLI::App&, NuclearOptions&);
 void SetCouplingConstants(CLI::App&, CouplingConstants&);
+void SetHistograms(CLI::App&, Histograms&);
 void SetCuts(CLI::App&, Cuts&);
+void SetFilter(CLI::App&, Filter&);
 void SetBetaDecayOptions(CLI::App&, BetaDecay&);
 void SetDecayOptions(CLI::App&, Decay&);
 void SetEnvironmentOptions(CLI::App&, EnvOptions&);
@@ -5,6 +5,7 @@
 #include "CRADLE/Messenger.hh"
 #include "CRADLE/Utilities.hh"
 #include "CRADLE/ConfigParser.hh"
+#include "CRADLE/WignerSymbols.hh"
 #include <complex>
 #include <string>
 
@@ -110,6 +111,24 @@ namespace CRADLE
       return a / CalculateXiBetaDecay(mf, mgt);
     }
 
+    // a = a0 + aCoulomb * alpha Z m_e / p_e, energy independent terms of CalculateBetaNeutrinoAsymmetry
+    inline void CalculateBetaNeutrinoAsymmetryTerms(double mf, double mgt, int betaType, double &a0, double &aCoulomb)
+    {
+      CouplingConstants c = (DecayManager::GetInstance()).configOptions.couplingConstants;
+      if (!std::isnan(c.a))
+      {
+        a0 = c.a; // set by user
+        aCoulomb = 0.;
+        return;
+      }
+
+      double xi = CalculateXiBetaDecay(mf, mgt);
+      a0 = (mf * mf * (-norm(c.CS) - norm(c.CSP) + norm(c.CV) + norm(c.CVP)) +
+            mgt * mgt / 3. * (-norm(c.CA) - norm(c.CAP) + norm(c.CT) + norm(c.CTP))) / xi;
+      aCoulomb = (-mf * mf * betaType * 2. * (c.CS * conj(c.CV) + c.CSP * conj(c.CVP)).imag() +
+                  mgt * mgt / 3. * betaType * 2. * (c.CT * conj(c.CA) + c.CTP * conj(c.CAP)).imag()) / xi;
+    }
+
     // A (Beta asymmetry)
     inline double CalculateBetaAssymetry(double mf, double mgt, double j_i, double j_f, int betaType, int Z, double energy)
     {
@@ -399,6 +418,86 @@ namespace CRADLE
       return max_pos;
     }
 
+    // ########## Direct sampling of the lepton directions ########## //
+
+    inline double RandomLinearCosine(double kappa, double r)
+    {
+      /*Inverse CDF of the density 1 + kappa*cos(theta) on cos(theta) in [-1, 1], r uniform in [0, 1]*/
+      if (std::abs(kappa) > 1.)
+      {
+        Error("Kappa value " + std::to_string(kappa) + " is out of physical range.");
+      }
+      if (std::abs(kappa) < 1e-10)
+        return 2. * r - 1.; // isotropic distribution
+
+      double disc = (1. - kappa) * (1. - kappa) + 4. * kappa * r;
+      double costheta = (-1. + std::sqrt(std::max(disc, 0.))) / kappa;
+      return std::max(-1., std::min(1., costheta));
+    }
+
+    inline void DirectionAroundAxis(const double axis[3], double costheta, double phi, double dir[3])
+    {
+      /*Unit vector making an angle acos(costheta) with axis, at azimuth phi around it. Falls back on the z axis if axis is null*/
+      double n[3] = {0., 0., 1.};
+      double norm = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+      if (norm > 1e-12)
+      {
+        n[0] = axis[0] / norm;
+        n[1] = axis[1] / norm;
+        n[2] = axis[2] / norm;
+      }
+
+      // orthonormal basis (t1, t2) of the plane perpendicular to n
+      double h[3] = {0., 0., 0.};
+      h[std::abs(n[0]) < 0.9 ? 0 : 1] = 1.;
+      double t1[3] = {n[1] * h[2] - n[2] * h[1], n[2] * h[0] - n[0] * h[2], n[0] * h[1] - n[1] * h[0]};
+      double t1Norm = std::sqrt(t1[0] * t1[0] + t1[1] * t1[1] + t1[2] * t1[2]);
+      for (int i = 0; i < 3; i++)
+        t1[i] /= t1Norm;
+      double t2[3] = {n[1] * t1[2] - n[2] * t1[1], n[2] * t1[0] - n[0] * t1[2], n[0] * t1[1] - n[1] * t1[0]};
+
+      double sintheta = std::sqrt(std::max(0., 1. - costheta * costheta));
+      for (int i = 0; i < 3; i++)
+        dir[i] = costheta * n[i] + sintheta * (std::cos(phi) * t1[i] + std::sin(phi) * t2[i]);
+    }
+
+    inline void SampleLeptonDirections(double a, double b, double c, double A, double B, double D, double E, const vector<double> &polDir, std::mt19937 &generator, vector<double> &elDir, vector<double> &enuDir)
+    {
+      /*Exact sampling of the electron and neutrino directions from the angular correlation factor of CalculateAngularCorrelationFactor.
+      Averaging over the neutrino direction leaves 1 + b*m/E + A*beta*(e.J) for the electron. For a fixed electron direction the factor is linear in
+      the neutrino direction, K + nu.V, so the neutrino is sampled from 1 + |V|/K*cos(psi) around V. No rejection is needed.*/
+      std::uniform_real_distribution<double> distribution(0., 1.);
+      double beta_e = std::sqrt(1 - EMASSC2 * EMASSC2 / E / E); // p_e/E_e; p_nu/E_nu = 1
+      double J[3] = {polDir(0), polDir(1), polDir(2)};
+
+      // Electron from its marginal distribution
+      double alpha = 1. + b * EMASSC2 / E;
+      double e[3];
+      double cosTheta_e = RandomLinearCosine(A * beta_e / alpha, distribution(generator));
+      DirectionAroundAxis(J, cosTheta_e, 2. * PI * distribution(generator), e);
+
+      // Neutrino from its conditional distribution
+      double eJ = e[0] * J[0] + e[1] * J[1] + e[2] * J[2];
+      double K = alpha + A * beta_e * eJ;
+      double JxE[3] = {J[1] * e[2] - J[2] * e[1], J[2] * e[0] - J[0] * e[2], J[0] * e[1] - J[1] * e[0]};
+      double V[3];
+      for (int i = 0; i < 3; i++)
+        V[i] = a * beta_e * e[i] + B * J[i] + D * beta_e * JxE[i] + c * beta_e * (e[i] / 3. - eJ * J[i]);
+      double VNorm = std::sqrt(V[0] * V[0] + V[1] * V[1] + V[2] * V[2]);
+
+      double nu[3];
+      double cosTheta_nu = RandomLinearCosine(K > 0 ? VNorm / K : 0., distribution(generator));
+      DirectionAroundAxis(V, cosTheta_nu, 2. * PI * distribution(generator), nu);
+
+      elDir.resize(3);
+      enuDir.resize(3);
+      for (int i = 0; i < 3; i++)
+      {
+        elDir(i) = e[i];
+        enuDir(i) = nu[i];
+      }
+    }
+
 //////////// *** GAMMA DECAY *** ////////////
 #include <cmath>
 #include <vector>
@@ -413,27 +512,6 @@ namespace CRADLE
     using std::sqrt;
     using std::vector;
 
-    //------------------------------------------------------------
-    // Utility: factorial for integer or half-integer arguments
-    // x must be integer or half-integer >= 0
-    //------------------------------------------------------------
-    inline double FactHalf(double x)
-    {
-      if (x < 0.0)
-        return 0.0;
-
-      // Gamma(x+1) = x!
-      return std::tgamma(x + 1.0);
-    }
-
-    //------------------------------------------------------------
-    // Triangle condition
-    //------------------------------------------------------------
-    inline bool Triangle(double a, double b, double c)
-    {
-      return (c <= a + b + 1e-12) && (c + 1e-12 >= abs(a - b));
-    }
-
     //------------------------------------------------------------
     // Check if j,m values are integer/half-integer compatible
     //------------------------------------------------------------
@@ -444,28 +522,18 @@ namespace CRADLE
     }
 
     //------------------------------------------------------------
-    // Delta coefficient for angular momentum algebra
+    // Doubled angular momentum (2j) of an integer/half-integer value
     //------------------------------------------------------------
-    inline double DeltaCoeff(double a, double b, double c)
+    inline int TwoJ(double x)
     {
-      if (!Triangle(a, b, c))
-        return 0.0;
-
-      double num = FactHalf(a + b - c) *
-                   FactHalf(a - b + c) *
-                   FactHalf(-a + b + c);
-      double den = FactHalf(a + b + c + 1.0);
-
-      if (den == 0.0)
-        return 0.0;
-      return sqrt(num / den);
+      return (int)std::lround(2.0 * x);
     }
 
     //------------------------------------------------------------
     // Wigner 3j symbol
     // ( j1 j2 j3 )
     // ( m1 m2 m3 )
-    // Racah formula
+    // see wigner::Wigner3j for the doubled-spin version
     //------------------------------------------------------------
     inline double Wigner3j(double j1, double j2, double j3,
                            double m1, double m2, double m3)
@@ -474,47 +542,12 @@ namespace CRADLE
           !IsHalfInteger(m1) || !IsHalfInteger(m2) || !IsHalfInteger(m3))
         throw std::runtime_error("Wigner3j: arguments must be integer or half-integer.");
 
-      if (abs(m1 + m2 + m3) > 1e-12)
-        return 0.0;
-      if (!Triangle(j1, j2, j3))
-        return 0.0;
-      if (abs(m1) > j1 || abs(m2) > j2 || abs(m3) > j3)
-        return 0.0;
-
-      double pref_phase = std::pow(-1.0, std::llround(j1 - j2 - m3));
-      double pref = pref_phase *
-                    DeltaCoeff(j1, j2, j3) *
-                    sqrt(FactHalf(j1 + m1) * FactHalf(j1 - m1) *
-                         FactHalf(j2 + m2) * FactHalf(j2 - m2) *
-                         FactHalf(j3 + m3) * FactHalf(j3 - m3));
-
-      double zmin = max({0.0, j2 - j3 - m1, j1 - j3 + m2});
-      double zmax = min({j1 + j2 - j3, j1 - m1, j2 + m2});
-
-      double sum = 0.0;
-      for (int iz = (int)std::ceil(zmin - 1e-12); iz <= (int)std::floor(zmax + 1e-12); ++iz)
-      {
-        double z = (double)iz;
-
-        double den =
-            FactHalf(z) *
-            FactHalf(j1 + j2 - j3 - z) *
-            FactHalf(j1 - m1 - z) *
-            FactHalf(j2 + m2 - z) *
-            FactHalf(j3 - j2 + m1 + z) *
-            FactHalf(j3 - j1 - m2 + z);
-
-        if (den == 0.0)
-          continue;
-
-        sum += std::pow(-1.0, iz) / den;
-      }
-
-      return pref * sum;
+      return wigner::Wigner3j(TwoJ(j1), TwoJ(j2), TwoJ(j3), TwoJ(m1), TwoJ(m2), TwoJ(m3));
     }
 
     //------------------------------------------------------------
-    // Wigner 6j symbol using Racah formula
+    // Wigner 6j symbol
+    // see wigner::Wigner6j for the doubled-spin version
     //------------------------------------------------------------
     inline double Wigner6j(double j1, double j2, double j3,
                            double l1, double l2, double l3)
@@ -523,48 +556,7 @@ namespace CRADLE
           !IsHalfInteger(l1) || !IsHalfInteger(l2) || !IsHalfInteger(l3))
         throw std::runtime_error("Wigner6j: arguments must be integer or half-integer.");
 
-      if (!Triangle(j1, j2, j3) ||
-          !Triangle(j1, l2, l3) ||
-          !Triangle(l1, j2, l3) ||
-          !Triangle(l1, l2, j3))
-        return 0.0;
-
-      double pref =
-          DeltaCoeff(j1, j2, j3) *
-          DeltaCoeff(j1, l2, l3) *
-          DeltaCoeff(l1, j2, l3) *
-          DeltaCoeff(l1, l2, j3);
-
-      double zmin = max({j1 + j2 + j3,
-                         j1 + l2 + l3,
-                         l1 + j2 + l3,
-                         l1 + l2 + j3});
-
-      double zmax = min({j1 + j2 + l1 + l2,
-                         j2 + j3 + l2 + l3,
-                         j3 + j1 + l3 + l1});
-
-      double sum = 0.0;
-      for (int iz = (int)std::ceil(zmin - 1e-12); iz <= (int)std::floor(zmax + 1e-12); ++iz)
-      {
-        double z = (double)iz;
-
-        double den =
-            FactHalf(z - j1 - j2 - j3) *
-            FactHalf(z - j1 - l2 - l3) *
-            FactHalf(z - l1 - j2 - l3) *
-            FactHalf(z - l1 - l2 - j3) *
-            FactHalf(j1 + j2 + l1 + l2 - z) *
-            FactHalf(j2 + j3 + l2 + l3 - z) *
-            FactHalf(j3 + j1 + l3 + l1 - z);
-
-        if (den == 0.0)
-          continue;
-
-        sum += std::pow(-1.0, iz) * FactHalf(z + 1.0) / den;
-      }
-
-      return pref * sum;
+      return wigner::Wigner6j(TwoJ(j1), TwoJ(j2), TwoJ(j3), TwoJ(l1), TwoJ(l2), TwoJ(l3));
     }
 
     //------------------------------------------------------------
@@ -572,41 +564,24 @@ namespace CRADLE
     //
     // Transition: J_initial -> J_final
     // Multipole pair: L, Lp
+    // I1, I2 given as doubled spins
     //------------------------------------------------------------
-    inline double GammaFk(double L, double Lp, double I1, double I2, double k)
+    inline double GammaFk(int L, int Lp, int tI1, int tI2, int k)
     {
-      if (k < 0 || ((int)k % 2 != 0))
-        return 0.0;
-
-      double first = std::pow(-1.0, std::llround(I1 + I2 - 1));
-
-      double second = sqrt((2.0 * L + 1.0) *
-                           (2.0 * Lp + 1.0) *
-                           (2.0 * I2 + 1.0) *
-                           (2.0 * k + 1.0));
-
-      double third = Wigner3j(L, Lp, k, 1., -1., 0.);
-
-      double fourth = Wigner6j(L, Lp, k, I2, I2, I1);
-
-      return first * second * third * fourth;
+      return wigner::GammaFk(L, Lp, tI1, tI2, k);
     }
-
     //------------------------------------------------------------
     // A_k for one mixed transition
     //
     // If delta = 0, pure L
     // If transition is mixed, use L and L+1
     //------------------------------------------------------------
-    inline double GammaAkSingleTransition(double L, double Lp, double I1, double I2, double delta, double k)
+    inline double GammaAkSingleTransition(int L, int Lp, int tI1, int tI2, double delta, int k)
     {
       // (eq.3)
-      double F_LLI1I2 = GammaFk(L, L, I1, I2, k);
-      // Info(Form("GammaAkSingleTransition: F(%d, %d, %f, %f) = %f", L, L, I1, I2, F_LLI1I2), 2);
-      double F_LLpI1I2 = GammaFk(L, Lp, I1, I2, k);
-      // Info(Form("GammaAkSingleTransition: F(%d, %d, %f, %f) = %f", L, Lp, I1, I2, F_LLpI1I2), 2);
-      double F_LpLpI1I2 = GammaFk(Lp, Lp, I1, I2, k);
-      // Info(Form("GammaAkSingleTransition: F(%d, %d, %f, %f) = %f", Lp, Lp, I1, I2, F_LpLpI1I2), 2);
+      double F_LLI1I2 = GammaFk(L, L, tI1, tI2, k);
+      double F_LLpI1I2 = GammaFk(L, Lp, tI1, tI2, k);
+      double F_LpLpI1I2 = GammaFk(Lp, Lp, tI1, tI2, k);
 
       return (F_LLI1I2 + 2.0 * delta * F_LLpI1I2 + delta * delta * F_LpLpI1I2) /
              (1.0 + delta * delta);
@@ -644,15 +619,13 @@ namespace CRADLE
       if (L1.first < 1 || L2.first < 1)
         return a;
 
-      double maxK = std::min(MaxEvenKForTransition(L1), MaxEvenKForTransition(L2));
+      int maxK = std::min(MaxEvenKForTransition(L1), MaxEvenKForTransition(L2));
+      int tJi = TwoJ(Ji), tJ = TwoJ(J), tJf = TwoJ(Jf);
 
-      // Info(Form("CaluclateGammaCoefficient_a: maxK1 = %d", maxK));
-
-      for (double k = 2.; k <= maxK; k += 2.)
+      for (int k = 2; k <= maxK; k += 2)
       {
-        // Info("k = " + std::to_string(k), 1);
-        double A1k = GammaAkSingleTransition(L1.first, L1.second, Ji, J, delta1, k);
-        double A2k = GammaAkSingleTransition(L2.first, L2.second, Jf, J, delta2, k);
+        double A1k = GammaAkSingleTransition(L1.first, L1.second, tJi, tJ, delta1, k);
+        double A2k = GammaAkSingleTransition(L2.first, L2.second, tJf, tJ, delta2, k);
 
         double ak = A1k * A2k;
         a.push_back(ak);
@@ -694,6 +667,80 @@ namespace CRADLE
       return w;
     }
 
+    //------------------------------------------------------------
+    // Integral of W from -1 to x (CDF of cos(theta), not normalised)
+    // W(x) = p0 + p2*x^2 + p4*x^4 expanded from the a coefficients
+    //------------------------------------------------------------
+    inline double GammaGammaCDF(double x, const vector<double> &a)
+    {
+      double a0 = a.size() >= 1 ? a[0] : 0.;
+      double a2 = a.size() >= 2 ? a[1] : 0.;
+      double a4 = a.size() >= 3 ? a[2] : 0.;
+
+      double p0 = a0 - 0.5 * a2 + 3.0 * a4 / 8.0;
+      double p2 = 1.5 * a2 - 30.0 * a4 / 8.0;
+      double p4 = 35.0 * a4 / 8.0;
+
+      double x2 = x * x;
+      return p0 * (x + 1.0) + p2 * (x2 * x + 1.0) / 3.0 + p4 * (x2 * x2 * x + 1.0) / 5.0;
+    }
+
+    //------------------------------------------------------------
+    // Inverse CDF table of cos(theta) for W(cos(theta)) dOmega
+    // table[i] = x such that CDF(x) = i/N * CDF(1)
+    // Built once per cascade, together with the a coefficients
+    //------------------------------------------------------------
+    inline vector<double> GammaGammaInverseCDFTable(const vector<double> &a, int N = 64)
+    {
+      vector<double> table(N + 1);
+      double total = GammaGammaCDF(1.0, a);
+      table[0] = -1.0;
+      table[N] = 1.0;
+
+      for (int i = 1; i < N; ++i)
+      {
+        double target = total * i / N;
+        double low = table[i - 1];
+        double high = 1.0;
+        for (int it = 0; it < 60; ++it)
+        {
+          double mid = 0.5 * (low + high);
+          if (GammaGammaCDF(mid, a) < target)
+            low = mid;
+          else
+            high = mid;
+        }
+        table[i] = 0.5 * (low + high);
+      }
+      return table;
+    }
+
+    //------------------------------------------------------------
+    // Sampling cos(theta) from one uniform r in [0, 1]
+    // Linear interpolation in the table refined by Newton steps
+    // on the polynomial CDF, kept inside the table bin
+    //------------------------------------------------------------
+    inline double RandomGammaGammaCosTheta(const vector<double> &a, const vector<double> &table, double r)
+    {
+      int N = table.size() - 1;
+      double pos = std::min(std::max(r, 0.0), 1.0) * N;
+      int i = std::min((int)pos, N - 1);
+      double low = table[i];
+      double high = table[i + 1];
+      double x = low + (pos - i) * (high - low);
+
+      double target = r * GammaGammaCDF(1.0, a);
+      for (int it = 0; it < 3; ++it)
+      {
+        double w = GammaGammaW(x, a);
+        if (w <= 1e-12)
+          break;
+        x -= (GammaGammaCDF(x, a) - target) / w;
+        x = std::min(std::max(x, low), high);
+      }
+      return x;
+    }
+
     //------------------------------------------------------------
     // Sampling theta analytically from the a coefficients
     // a = [a0, a2, a4, ...]
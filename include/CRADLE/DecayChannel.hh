@@ -18,6 +18,7 @@ class DecayChannel {
     inline double GetIntensity() { return intensity; };
     inline double GetQValue() { return Q; };
     inline double GetLifetime() { return lifetime; };
+    inline double GetLevelWidth() { return levelWidth; };
     inline double GetDaughterExcitationEnergy() { return daughterExcitationEnergy; };
     inline double GetParentExcitationEnergy() { return parentExcitationEnergy; };
     inline std::string GetModeName() { return modeName; };
@@ -31,6 +32,7 @@ class DecayChannel {
     double intensity;
     double Q;
     double lifetime;
+    double levelWidth; // Breit-Wigner half width of the parent level (keV)
     std::pair<int, int> Multipolarities;
     double mixingRatio;
     std::string modeName;
@@ -3,12 +3,20 @@
 
 #include <vector>
 #include <map>
+#include <algorithm>
 #include <string>
 #include <random>
+#include <functional>
+#include <ctime>
+#include <mutex>
+#include <unordered_map>
 
 #include "CRADLE/ConfigParser.hh"
 #include "CRADLE/Messenger.hh"
 #include "CRADLE/PDGcode.hh"
+#include "CRADLE/GammaCascade.hh"
+#include "CRADLE/DecayPlan.hh"
+#include "CRADLE/BlockCompression.hh"
 
 #include "TFile.h"
 #include "TTree.h"
@@ -32,6 +40,105 @@ struct ParticleData {
     double pz = 0.;
 };
 
+// Generated particles stored column-wise, one entry per particle. Events are appended
+// one after the other; event, multiplicity and weight give the event number, its size and weight.
+struct ParticleBuffer {
+    std::vector<int> event;
+    std::vector<int> multiplicity;
+    std::vector<int> code;
+    std::vector<double> time;
+    std::vector<double> excitation_energy;
+    std::vector<double> kinetic_energy;
+    std::vector<double> p;
+    std::vector<double> px;
+    std::vector<double> py;
+    std::vector<double> pz;
+    std::vector<double> weight; // weight of the event, 1 unless channels are biased
+
+    inline std::size_t Size() const { return code.size(); };
+    inline void Clear() {
+        event.clear(); multiplicity.clear(); code.clear(); time.clear();
+        excitation_energy.clear(); kinetic_energy.clear();
+        p.clear(); px.clear(); py.clear(); pz.clear(); weight.clear();
+    };
+    // Drops the particles from n on, e.g. an event rejected by the filter
+    inline void Truncate(std::size_t n) {
+        event.resize(std::min(n, event.size())); multiplicity.resize(std::min(n, multiplicity.size()));
+        weight.resize(std::min(n, weight.size()));
+        code.resize(n); time.resize(n); excitation_energy.resize(n); kinetic_energy.resize(n);
+        p.resize(n); px.resize(n); py.resize(n); pz.resize(n);
+    };
+};
+
+// Histogram of the histogram mode, given as variable:particle:bins:min:max[:cut] in the config
+struct HistogramDefinition {
+    std::string name;
+    std::string variable;
+    std::vector<double> ParticleBuffer::*column = nullptr; // filled column, nullptr for cos
+    int code = 0; // 0: every particle
+    int secondCode = 0; // second particle of cos
+    int bins = 100;
+    double min = 0.;
+    double max = 1.;
+    std::vector<double> ParticleBuffer::*cutColumn = nullptr; // nullptr if no cut
+    bool cutAbove = true; // keeps the particles above cutValue, else below
+    double cutValue = 0.;
+};
+
+// Event filter of the [Filter] section, evaluated by the workers on the particles written
+// for an event: the event is kept if one of them is selected and passes every predicate
+struct EventFilter {
+    bool enabled = false;
+    std::vector<int> codes; // selected PDG codes, empty: every particle
+    double energyMin = 0.;
+    double energyMax = 1.e10;
+    double timeMin = 0.;
+    double timeMax = 1.e10;
+    double direction[3] = {0., 0., 1.}; // unit vector of the cone axis
+    double cosCone = -1.; // cosine of the half angle of the cone
+    std::vector<char> reachable; // per decay plan node: a selected particle may still be emitted below the level
+
+    inline bool Selects(int code) const {
+        return codes.empty() || std::find(codes.begin(), codes.end(), code) != codes.end();
+    };
+    inline bool Accept(int code, double time, double energy, double ux, double uy, double uz) const {
+        return Selects(code) && energy >= energyMin && energy <= energyMax && time >= timeMin && time <= timeMax
+            && (cosCone <= -1. || ux * direction[0] + uy * direction[1] + uz * direction[2] >= cosCone);
+    };
+};
+
+// PDG codes met in the output file, stored once per file; the Compact output
+// profile writes the index of the code in this table instead of the code itself
+class ParticleCodeTable {
+  public:
+    unsigned short GetIndex(int);
+    std::vector<int> GetCodes();
+    void Clear();
+
+  private:
+    std::mutex mutex;
+    std::unordered_map<int, unsigned short> indices;
+    std::vector<int> codes;
+};
+
+// Reduced precision columns of the Compact output profile: floats for times and energies,
+// directions truncated to a 12 bit mantissa, and PDG codes as indices into the code table of the file
+struct CompactParticleBuffer {
+    std::vector<unsigned short> code;
+    std::vector<float> time;
+    std::vector<float> excitation_energy;
+    std::vector<float> kinetic_energy;
+    std::vector<float> p;
+    std::vector<float> px;
+    std::vector<float> py;
+    std::vector<float> pz;
+
+    // Per-thread copy of the code table, avoids locking the shared table for known codes
+    std::unordered_map<int, unsigned short> codeCache;
+
+    void Assign(const ParticleBuffer&, ParticleCodeTable&);
+};
+
 struct ChannelProperties {
     std::vector<std::vector<double>>* distribution; // 2D vector for the distribution of the channel
     double MAX_distribution = 0.; // Maximum of the distribution for rejection sampling
@@ -51,6 +158,33 @@ struct ChannelProperties {
     double mgt = -1;
 };
 
+// Beta spectrum of one branch computed on an energy grid (spectrum mode)
+struct BetaBranchSpectrum {
+    double Q = 0.; // Q value from the decay data, negative for beta+
+    double E0 = 0.; // endpoint kinetic energy (keV)
+    double intensity = 0.;
+    double parentExcitationEnergy = 0.;
+    double daughterExcitationEnergy = 0.;
+    double parentMass = 0.;
+    int betaSign = 0; // -1: beta-, 1: beta+
+    int betaType = 0; // 0: Fermi, 1: Gamow-Teller, 2: Mixed
+    int Z = 0; // daughter charge, signed as for the spectrum generators
+    int A = 0;
+    double mf = 0.;
+    double mgt = 0.;
+    double mixingRatio = 0.; // Fermi/Gamow-Teller mixing ratio of mixed transitions
+    double j_i = 0.;
+    double j_f = 0.;
+    double b = 0.; // Fierz term
+
+    std::vector<double> energy; // kinetic energy of the charged lepton (keV)
+    std::vector<double> shape; // spectrum height (phase space and selected corrections)
+    std::vector<double> distribution; // shape including Fierz term and weak magnetism, as sampled by the generator
+    std::vector<double> a; // beta-neutrino correlation
+    std::vector<double> A_beta; // beta asymmetry
+    std::vector<double> radiative; // radiative correction factor
+};
+
 class DecayManager {
   public:
     static DecayManager& GetInstance() {
@@ -64,6 +198,7 @@ class DecayManager {
     bool Initialise(ConfigOptions);
     bool Initialise(std::string, int, int, double, std::string, int);
     bool MainLoop();
+    bool SpectrumLoop(double = 1.);
     bool GenerateNucleus(std::string, int, int);
     void RegisterBasicParticles();
     void RegisterBasicDecayModes();
@@ -84,35 +219,57 @@ class DecayManager {
     double GetChannelMf(const std::string);
     void SetChannelMgt(const std::string, double);
     double GetChannelMgt(const std::string);
+
+    void RegisterGammaCascadeTable(const int, const GammaCascadeTable&);
+    const GammaCascadeTable* GetGammaCascadeTable(const int) const;
     
     void RegisterSpectrumGenerator(const std::string, SpectrumGenerator&);
     void RegisterBasicSpectrumGenerators();
     void ListRegisteredParticles();
+    void CompileDecayPlan();
+    inline const DecayPlan& GetDecayPlan() const { return decayPlan; };
+    void CompileEventFilter();
+    inline bool IsFiltering() const { return eventFilter.enabled; };
+    double GetDecayTime(Particle*);
+    bool IsDecayedWithinCuts(Particle*, double, double);
+    bool IsFlightWithinCut(Particle*, double);
+    std::vector<Particle*> DecayParticle(Particle*, double&);
+    std::size_t GenerateEvent(int, int, ParticleBuffer&);
     std::vector<ParticleData> GenerateEvent_ROOT(int, int);
     std::string GenerateEvent_TXT(int, int);
+    void GenerateEvent_TXT(int, int, std::string&);
     Particle* GetNewParticle(const int, int Z=0, int A=0, bool temp = false);
     DecayMode& GetDecayMode(const std::string);
     ConfigOptions configOptions;
-    std::mt19937 generator;
 
     void WriteDecayData(std::string, std::string);
     void WriteConfigData(std::string);
 
     std::map<const std::string, ChannelProperties> registeredChannelProperties;
-
-    // bool MergeParticleTreesInPlace(const std::string& filename,
-    //                            const std::string& inputPrefix = "ParticleTree_",
-    //                            const std::string& mergedTreeName = "ParticleTree");
+    std::map<const int, GammaCascadeTable> registeredGammaCascadeTables;
 
   private:
     DecayManager() {};
     DecayManager(DecayManager const&);
     void operator=(DecayManager const&);
 
+    void GenerateBlocks(int, int, clock_t, const std::function<void(int, int, std::string&)>&, const std::function<bool(const std::string&)>&);
+    bool WriteToDescriptor(int, const char*, std::size_t);
+    bool WriteEvents_TXT(int, compression::Format, int, clock_t);
+    bool WriteEvents_CEV(int, bool, int, clock_t);
+    HistogramDefinition ParseHistogramDefinition(const std::string&);
+    bool FillHistograms(int, clock_t);
+    bool CanPassFilter(const std::vector<Particle*>&, double) const;
+    void ForceDecayPath();
+    void BiasDecayPlan();
+
     
     std::map<const std::string, DecayMode&> registeredDecayModes;
     std::vector<Particle*> particleStack;
     std::map<const int, Particle*> registeredParticles;
+    DecayPlan decayPlan;
+    EventFilter eventFilter;
+    ParticleCodeTable codeTable;
     std::string outputName;
     std::string ConfigFilename;
     std::string initStateName;
@@ -123,122 +280,5 @@ class DecayManager {
     TFile *outputFile;
 };
 
-
-inline bool MergeParticleTreesInPlace(const std::string& filename,
-                               const std::string& inputPrefix = "ParticleTree_",
-                               const std::string& mergedTreeName = "ParticleTree")
-{
-  DecayManager& dm = DecayManager::GetInstance();
-    Start("Merging Thread TTree");
-
-    TFile* file = TFile::Open(filename.c_str(), "UPDATE");
-    if (!file || file->IsZombie()) {
-        Error("Error: output ROOT file is corrupted or not finalized: " + filename);
-        if (file) {
-            file->Close();
-            delete file;
-        }
-        return false;
-    }
-
-    std::vector<std::string> treeNames;
-
-    TIter next(file->GetListOfKeys());
-    TKey* key = nullptr;
-    while ((key = dynamic_cast<TKey*>(next()))) {
-        // Do not instantiate objects just to check the class
-        if (std::string(key->GetClassName()) != "TTree")
-            continue;
-
-        const std::string name = key->GetName();
-        if (name.rfind(inputPrefix, 0) == 0)
-            treeNames.push_back(name);
-    }
-
-    if (treeNames.empty()) {
-        Error("No trees found with prefix " + inputPrefix + " in file " + filename);
-        file->Close();
-        delete file;
-        return false;
-    }
-
-    std::sort(treeNames.begin(), treeNames.end());
-
-    // Remove previous merged tree if present
-    if (file->GetListOfKeys()->FindObject(mergedTreeName.c_str())) {
-        file->Delete((mergedTreeName + ";*").c_str());
-        file->SaveSelf(kTRUE);
-    }
-
-    TTree* firstTree = nullptr;
-    file->GetObject(treeNames.front().c_str(), firstTree);
-    if (!firstTree) {
-        Warning("Cannot read first tree: " + treeNames.front() + ". Aborting merge.");
-        file->Close();
-        delete file;
-        return false;
-    }
-
-    file->cd();
-
-    // IMPORTANT: raw pointer, ROOT/file owns it after SetDirectory
-    TTree* mergedTree = firstTree->CloneTree(0);
-    if (!mergedTree) {
-        Warning("Failed to clone tree structure for merging. Aborting merge.");
-        file->Close();
-        delete file;
-        return false;
-    }
-
-    mergedTree->SetName(mergedTreeName.c_str());
-    mergedTree->SetTitle(mergedTreeName.c_str());
-    mergedTree->SetDirectory(file);
-
-    Long64_t totalEntries = 0;
-
-    for (const auto& name : treeNames) {
-        TTree* inTree = nullptr;
-        file->GetObject(name.c_str(), inTree);
-        if (!inTree) {
-            Warning("Cannot read tree: " + name + ". Skipping.");
-            continue;
-        }
-
-        const Long64_t copied = mergedTree->CopyEntries(inTree, -1, "fast");
-        totalEntries += copied;
-
-        if (dm.configOptions.general.Verbosity >= 2) {
-            Info("Merged tree " + name + " with " + std::to_string(inTree->GetEntries()) + " entries.", 1);
-        }
-    }
-
-    file->cd();
-    mergedTree->Write("", TObject::kOverwrite);
-    file->SaveSelf(kTRUE);
-    file->Flush();
-
-    if (dm.configOptions.general.Verbosity >= 2) {
-        Info("Merged tree " + mergedTreeName + " written with " +
-             std::to_string(mergedTree->GetEntries()) + " entries.", 1);
-    }
-
-    // Delete original thread trees only after merged tree is safely written
-    for (const auto& name : treeNames) {
-        file->Delete((name + ";*").c_str());
-        if (dm.configOptions.general.Verbosity >= 2) {
-            Info("Deleted original tree " + name + " from file after merging.", 1);
-        }
-    }
-
-    file->SaveSelf(kTRUE);
-    file->Write("", TObject::kOverwrite);
-    file->Flush();
-    file->Close();
-    delete file;
-
-    Success("TTree has been merged successfully");
-    return true;
-}
-
 }//End of CRADLE namespace
 #endif
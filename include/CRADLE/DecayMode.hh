@@ -4,6 +4,7 @@
 #include <vector>
 #include <boost/numeric/ublas/vector.hpp>
 #include <string>
+#include <random>
 #include "CRADLE/Messenger.hh"
 
 namespace CRADLE {
@@ -29,6 +30,38 @@ class DecayMode {
     SpectrumGenerator* spectrumGen;
 };
 
+// Unpolarised allowed beta decays of one channel, generated by batches in structure of
+// arrays in the rest frame of the parent: lepton energy from the inverse CDF of the
+// spectrum, isotropic neutrino, charged lepton from 1 + b m/W + a p/W cos(theta) and
+// neutrino momentum from energy conservation (closed form of ThreeBodyDecay).
+class BetaDecayBatch {
+  public:
+    BetaDecayBatch(const std::vector<std::vector<double> >&, double, double, double, double, double, double, double);
+
+    void Generate(std::size_t, std::mt19937_64&);
+    inline bool Empty() const { return cursor == leptonE.size(); };
+    inline std::size_t Next() { return cursor++; };
+
+    // charged lepton, neutrino and recoil 4-momenta
+    std::vector<double> leptonE, leptonPx, leptonPy, leptonPz;
+    std::vector<double> neutrinoE, neutrinoPx, neutrinoPy, neutrinoPz;
+    std::vector<double> recoilE, recoilPx, recoilPy, recoilPz;
+
+  private:
+    double E0; // kinetic energy release (keV)
+    double massLepton;
+    double massNeutrino;
+    double massRecoil;
+    double a0; // a = a0 + aCoulomb m/p
+    double aCoulomb;
+    double b;
+
+    double begin; // energy range of the spectrum
+    double end;
+    std::vector<double> cdf; // cumulative of the spectrum bins, normalised to 1
+    std::size_t cursor = 0;
+};
+
 class Beta: public DecayMode {
   public:
     static Beta& GetInstance() {
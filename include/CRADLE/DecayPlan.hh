@@ -0,0 +1,62 @@
+#ifndef DECAYPLAN
+#define DECAYPLAN
+
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+#include <cmath>
+
+namespace CRADLE {
+
+class DecayChannel;
+
+// One (nucleus, level) state reachable from the initial state
+struct DecayPlanNode {
+    int pdg;
+    double excitationEnergy;
+    double lifetime; // s, 1e46 if the level does not decay
+    double levelWidth; // Breit-Wigner half width (keV)
+    std::vector<DecayChannel*> channels; // channels leaving the level
+    std::vector<int> children; // node of the daughter nucleus for each channel, -1 if not followed
+    std::vector<double> intensities; // sampled intensities, 0 for the channels left out of a forced path
+    std::vector<double> aliasProbability; // Walker alias table over the (biased) channel intensities
+    std::vector<int> aliasIndex;
+    std::vector<double> weights; // natural over sampled probability of each channel, 1 without bias
+};
+
+// Decay graph reachable from the initial state, compiled once before the event loop.
+// Nodes are stored in a flat array and refer to their daughters by index, so that
+// an event only samples the alias table of the current node to pick a channel.
+class DecayPlan {
+  public:
+    void Clear();
+    int AddNode(int, double, const std::vector<DecayChannel*>&);
+    int FindNode(int, double) const;
+    int SampleChannel(int, double) const;
+    void SetBias(int, const std::vector<double>&);
+    double ForceChannels(int, const std::vector<char>&);
+
+    inline void SetChild(int node, std::size_t channel, int child) { nodes[node].children[channel] = child; };
+    inline const DecayPlanNode& GetNode(int node) const { return nodes[node]; };
+    inline std::size_t GetNumberOfNodes() const { return nodes.size(); };
+    inline bool IsBiased() const { return biased; };
+    inline bool IsForced() const { return forced; };
+    inline double GetBranchingRatio() const { return branchingRatio; }; // natural branching ratio of the forced path
+    inline bool IsSameLevel(int node, int pdg, double excitationEnergy) const {
+      return nodes[node].pdg == pdg && std::abs(nodes[node].excitationEnergy - excitationEnergy) < LevelTolerance;
+    };
+
+  private:
+    void BuildAliasTable(DecayPlanNode&, const std::vector<double>&);
+
+    double LevelTolerance = 2.; // keV, same as Particle::LevelEnergyUncertainty
+    bool biased = false;
+    bool forced = false;
+    double branchingRatio = 1.;
+
+    std::vector<DecayPlanNode> nodes;
+    std::unordered_multimap<int, int> nodesByPDG;
+};
+
+}//End of CRADLE namespace
+#endif
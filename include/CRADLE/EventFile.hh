@@ -0,0 +1,229 @@
+#ifndef EVENTFILE
+#define EVENTFILE
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace CRADLE {
+
+// CRADLE event file (.cev): fixed layout little-endian binary file made of
+//   - a 128 byte CevHeader,
+//   - chunks aligned on 64 bytes: a CevChunkHeader, nEvents+1 uint32 offsets of the first
+//     particle of each event in the chunk, padding to 64 bytes and the nParticles CevParticle,
+//   - the chunk index (nChunks uint64 file offsets) and the PDG table (nCodes int32 codes
+//     met in the file), pointed to by the header once the file is complete. In a stream the
+//     header cannot be completed: chunkIndexOffset stays 0 and the PDG table runs to the end.
+// The header and the chunks only hold PODs, so a reader can map the file and use them in place.
+namespace cev {
+
+    const char Magic[8] = {'C', 'R', 'A', 'D', 'L', 'E', 'E', 'V'};
+    const uint32_t Version = 1;
+    const std::size_t Alignment = 64;
+
+    struct CevHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t headerSize;
+        uint64_t configHash; // FNV-1a hash of the config file
+        uint64_t seed; // seed of the generator, 0 if unset
+        uint64_t nEvents;
+        uint64_t nChunks;
+        uint64_t chunkIndexOffset; // 0 while the file is being written
+        uint64_t pdgTableOffset;
+        uint32_t nCodes;
+        uint32_t reserved0;
+        double branchingRatio; // natural branching ratio of the generated decay path, 1 unless forced
+        uint64_t reserved[6];
+    };
+
+    struct CevChunkHeader {
+        uint64_t firstEvent;
+        uint32_t nEvents;
+        uint32_t nParticles;
+    };
+
+    struct CevParticle {
+        int32_t code; // PDG code
+        float weight; // weight of the event, 1 unless decay channels are biased
+        double time;
+        double excitation_energy;
+        double kinetic_energy;
+        double p;
+        double px;
+        double py;
+        double pz;
+    };
+
+    static_assert(sizeof(CevHeader) == 128, "CevHeader must be 128 bytes");
+    static_assert(sizeof(CevChunkHeader) == 16, "CevChunkHeader must be 16 bytes");
+    static_assert(sizeof(CevParticle) == 64, "CevParticle must be 64 bytes");
+
+    inline std::size_t Align(std::size_t size) { return (size + Alignment - 1) / Alignment * Alignment; };
+
+    // Offset of the first particle record from the start of a chunk of n events
+    inline std::size_t ParticleOffset(uint32_t nEvents) { return Align(sizeof(CevChunkHeader) + (nEvents + 1) * sizeof(uint32_t)); };
+
+    inline uint64_t Hash(const char *data, std::size_t size, uint64_t hash = 14695981039346656037ULL)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    };
+
+    // One event of a mapped file, the particles are read in place
+    struct EventView {
+        uint64_t number;
+        const CevParticle *first;
+        const CevParticle *last;
+
+        inline std::size_t size() const { return last - first; };
+        inline const CevParticle *begin() const { return first; };
+        inline const CevParticle *end() const { return last; };
+        inline const CevParticle &operator[](std::size_t i) const { return first[i]; };
+    };
+
+    // Header-only reader: maps the whole file read-only and gives access to the events
+    // without copying them. Only depends on POSIX, so it can be used outside of CRADLE++.
+    class EventFileReader {
+      public:
+        explicit EventFileReader(const std::string &fileName)
+        {
+            int fd = open(fileName.c_str(), O_RDONLY);
+            if (fd < 0)
+                throw std::runtime_error("Could not open event file " + fileName);
+            struct stat st;
+            if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(CevHeader)))
+            {
+                close(fd);
+                throw std::runtime_error("Invalid event file " + fileName);
+            }
+            size = st.st_size;
+            void *ptr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            close(fd);
+            if (ptr == MAP_FAILED)
+                throw std::runtime_error("Could not map event file " + fileName);
+            data = static_cast<const char *>(ptr);
+            madvise(ptr, size, MADV_SEQUENTIAL);
+
+            header = reinterpret_cast<const CevHeader *>(data);
+            if (std::memcmp(header->magic, Magic, sizeof(Magic)) != 0 || header->version != Version)
+                Unmap("Not a CRADLE event file " + fileName);
+            if (header->chunkIndexOffset == 0 || header->chunkIndexOffset + header->nChunks * sizeof(uint64_t) > size ||
+                header->pdgTableOffset + header->nCodes * sizeof(int32_t) > size)
+                Unmap("Incomplete event file " + fileName);
+            chunkOffsets = reinterpret_cast<const uint64_t *>(data + header->chunkIndexOffset);
+            codes = reinterpret_cast<const int32_t *>(data + header->pdgTableOffset);
+        };
+        ~EventFileReader() { munmap(const_cast<char *>(data), size); };
+        EventFileReader(const EventFileReader &) = delete;
+        EventFileReader &operator=(const EventFileReader &) = delete;
+
+        inline const CevHeader &GetHeader() const { return *header; };
+        inline uint64_t GetNumberOfEvents() const { return header->nEvents; };
+        inline uint64_t GetNumberOfChunks() const { return header->nChunks; };
+        inline std::vector<int> GetCodes() const { return std::vector<int>(codes, codes + header->nCodes); };
+
+        inline const CevChunkHeader &GetChunk(uint64_t chunk) const { return *reinterpret_cast<const CevChunkHeader *>(data + chunkOffsets[chunk]); };
+
+        inline EventView GetEvent(uint64_t chunk, uint32_t event) const
+        {
+            const char *base = data + chunkOffsets[chunk];
+            const CevChunkHeader *chunkHeader = reinterpret_cast<const CevChunkHeader *>(base);
+            const uint32_t *offsets = reinterpret_cast<const uint32_t *>(base + sizeof(CevChunkHeader));
+            const CevParticle *particles = reinterpret_cast<const CevParticle *>(base + ParticleOffset(chunkHeader->nEvents));
+            return EventView{chunkHeader->firstEvent + event, particles + offsets[event], particles + offsets[event + 1]};
+        };
+
+        // Calls f(const EventView&) for every event of the file, in order
+        template <class F>
+        void ForEachEvent(F f) const
+        {
+            for (uint64_t c = 0; c < header->nChunks; ++c)
+            {
+                const uint32_t n = GetChunk(c).nEvents;
+                for (uint32_t e = 0; e < n; ++e)
+                    f(GetEvent(c, e));
+            }
+        };
+
+      private:
+        // The destructor does not run when the constructor throws
+        [[noreturn]] void Unmap(const std::string &message)
+        {
+            munmap(const_cast<char *>(data), size);
+            throw std::runtime_error(message);
+        };
+
+        const char *data = nullptr;
+        std::size_t size = 0;
+        const CevHeader *header = nullptr;
+        const uint64_t *chunkOffsets = nullptr;
+        const int32_t *codes = nullptr;
+    };
+
+    // Sequential reader for a stream (stdin, FIFO): reads one chunk at a time and gives
+    // access to its events until the nChunks chunks announced in the header are read
+    class EventStreamReader {
+      public:
+        explicit EventStreamReader(std::FILE *_file) : file(_file)
+        {
+            if (std::fread(&header, sizeof(header), 1, file) != 1 || std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version)
+                throw std::runtime_error("Not a CRADLE event stream");
+        };
+
+        inline const CevHeader &GetHeader() const { return header; };
+
+        // Next event of the stream, false once all the events are read
+        bool NextEvent(EventView &event)
+        {
+            while (nextEvent >= nEvents)
+            {
+                if (chunksRead == header.nChunks)
+                    return false;
+                CevChunkHeader chunkHeader;
+                if (std::fread(&chunkHeader, sizeof(chunkHeader), 1, file) != 1)
+                    throw std::runtime_error("Truncated CRADLE event stream");
+                const std::size_t size = Align(ParticleOffset(chunkHeader.nEvents) + chunkHeader.nParticles * sizeof(CevParticle));
+                chunk.resize(size / sizeof(uint64_t));
+                std::memcpy(chunk.data(), &chunkHeader, sizeof(chunkHeader));
+                if (std::fread(reinterpret_cast<char *>(chunk.data()) + sizeof(chunkHeader), size - sizeof(chunkHeader), 1, file) != 1)
+                    throw std::runtime_error("Truncated CRADLE event stream");
+                ++chunksRead;
+                firstEvent = chunkHeader.firstEvent;
+                nEvents = chunkHeader.nEvents;
+                nextEvent = 0;
+            }
+            const char *base = reinterpret_cast<const char *>(chunk.data());
+            const uint32_t *offsets = reinterpret_cast<const uint32_t *>(base + sizeof(CevChunkHeader));
+            const CevParticle *particles = reinterpret_cast<const CevParticle *>(base + ParticleOffset(nEvents));
+            event = EventView{firstEvent + nextEvent, particles + offsets[nextEvent], particles + offsets[nextEvent + 1]};
+            ++nextEvent;
+            return true;
+        };
+
+      private:
+        std::FILE *file;
+        CevHeader header;
+        std::vector<uint64_t> chunk; // 8 byte aligned storage of the current chunk
+        uint64_t chunksRead = 0;
+        uint64_t firstEvent = 0;
+        uint32_t nEvents = 0;
+        uint32_t nextEvent = 0;
+    };
+}
+
+}//End of CRADLE namespace
+#endif
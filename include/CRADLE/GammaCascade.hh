@@ -0,0 +1,53 @@
+#ifndef GAMMACASCADE
+#define GAMMACASCADE
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+namespace CRADLE {
+
+// Angular correlation of one gamma-gamma cascade E_i --> E_m --> E_f
+struct GammaCascade {
+    std::vector<double> ak; // a_k coefficients of W(theta), a0 = 1
+    std::vector<double> cdfTable; // inverse CDF table of cos(theta)
+};
+
+// All gamma-gamma cascades of one nucleus, computed once when the level scheme is loaded.
+// Cascades are grouped by intermediate level: for level m with n_in feeding and n_out
+// depopulating gammas, the cascade (in, m, out) sits at cascadeOffset[m] + in*n_out + out.
+class GammaCascadeTable {
+  public:
+    void AddLevel(double, double);
+    void AddTransition(double, double, std::pair<int, int>, double);
+    void Build();
+
+    int FindLevel(double) const;
+    const GammaCascade* GetCascade(double, double, double) const;
+    inline std::size_t GetNumberOfCascades() const { return cascades.size(); };
+
+  private:
+    struct Transition {
+      double parentEnergy;
+      double daughterEnergy;
+      std::pair<int, int> multipolarities;
+      double mixingRatio;
+    };
+
+    double LevelTolerance = 1.; // keV, same as utilities::GetJpi
+
+    std::vector<double> levelEnergies; // sorted after Build()
+    std::vector<double> levelSpins;
+    std::vector<Transition> transitions;
+
+    // per level, CSR lists of feeding (in) and depopulating (out) transitions
+    std::vector<int> inOffset;
+    std::vector<int> inLevel;
+    std::vector<int> outOffset;
+    std::vector<int> outLevel;
+    std::vector<int> cascadeOffset;
+    std::vector<GammaCascade> cascades;
+};
+
+}//End of CRADLE namespace
+#endif
@@ -0,0 +1,61 @@
+#ifndef GENERATOR
+#define GENERATOR
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "CRADLE/ConfigParser.hh"
+#include "CRADLE/DecayManager.hh"
+
+namespace CRADLE {
+
+// One generated event; the particle columns keep their capacity from one call to the next,
+// so a record reused by the caller is filled without allocating
+struct EventRecord {
+    int eventNumber = -1;
+    ParticleBuffer particles;
+};
+
+// In-process event generation for applications linking against Cradle (e.g. the primary
+// generator of a Geant4 worker thread): events go straight into caller-provided records,
+// no file is written. All the Generators of a process share the DecayManager set up by
+// the first one: a Generator built from options that change the events (nucleus, couplings,
+// cuts, filter, decay and beta options, data files, Verbosity_file) throws std::runtime_error.
+// The random engines are per thread, so the handles of different threads run concurrently.
+class Generator {
+  public:
+    explicit Generator(const ConfigOptions&);
+
+    // Per-thread handle: reserves event numbers by blocks, to be used by one thread at a time
+    class Handle {
+      public:
+        std::size_t Generate(EventRecord*, std::size_t);
+        inline std::size_t Generate(EventRecord &event) { return Generate(&event, 1); };
+        template <class Container>
+        inline std::size_t Generate(Container &events) { return Generate(events.data(), events.size()); };
+
+      private:
+        friend class Generator;
+        explicit Handle(Generator &_generator) : generator(&_generator) {};
+
+        Generator *generator;
+        int nextEvent = 0;
+        int lastEvent = 0;
+    };
+
+    inline Handle CreateHandle() { return Handle(*this); };
+    // Natural branching ratio of the generated decay path, 1 unless Decay.ForcePath is set
+    inline double GetBranchingRatio() const { return decayManager.GetDecayPlan().GetBranchingRatio(); };
+
+  private:
+    static const int EventBlock = 256;
+    static const int MaxFilterTries = 1000000; // consecutive decays rejected by the filter before giving up
+
+    DecayManager &decayManager;
+    int verbosity;
+    std::atomic<int> nextEvent{0};
+};
+
+}//End of CRADLE namespace
+#endif
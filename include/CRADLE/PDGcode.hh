@@ -3,6 +3,8 @@
 
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include "CRADLE/Messenger.hh"
 
 inline const std::map<std::string, int> NametoCode_map = {
@@ -2995,13 +2997,21 @@ inline int NametoPDG(std::string name)
     }
 }
 
-inline std::string PDGtoName(int code)
+// Reverse index of NametoCode_map, the first name in map order is kept for codes with aliases (4He/alpha)
+inline const std::unordered_map<int, std::string> CodetoName_map = []
 {
+    std::unordered_map<int, std::string> codeToName;
+    codeToName.reserve(NametoCode_map.size());
     for (const auto& pair : NametoCode_map)
-    {
-        if (pair.second == code)
-            return pair.first;
-    }
+        codeToName.emplace(pair.second, pair.first);
+    return codeToName;
+}();
+
+inline std::string PDGtoName(int code)
+{
+    auto it = CodetoName_map.find(code);
+    if (it != CodetoName_map.end())
+        return it->second;
     Warning("No particle name found for PDG code " + std::to_string(code));
     return "";
 }
@@ -3020,4 +3030,11 @@ inline const std::vector<int> RestrictedParticleList = {
 	2112, // neutron
 };
 
+inline const std::unordered_set<int> RestrictedParticleSet(RestrictedParticleList.begin(), RestrictedParticleList.end());
+
+inline bool IsRestrictedParticle(int code)
+{
+    return RestrictedParticleSet.count(code) != 0;
+}
+
 #endif  
\ No newline at end of file
@@ -32,7 +32,7 @@ namespace CRADLE
     ublas::vector<double> fourMomentum;
     std::vector<DecayChannel *> decayChannels;
 
-    static std::default_random_engine randomGen;
+    static thread_local std::default_random_engine randomGen; // one engine per thread
 
     double LevelEnergyUncertainty = 2; // keV, threshold for considering two levels as degenerate
 
@@ -56,7 +56,9 @@ namespace CRADLE
 
     std::vector<Particle *> Decay();
     double GetLifetime() const;
+    double GetLevelWidth() const;
     double GetDecayTime();
+    double GetDecayTime(double);
     double GetMixingRatio(double, double) const;
     std::pair<int, int> GetMultipolarities(double, double) const;
 
@@ -113,6 +115,10 @@ namespace CRADLE
     Particle* lastGamma = nullptr;
     inline void SetLastGamma(Particle* g) { delete lastGamma; lastGamma = g; };
     inline Particle* GetLastGamma() const { return lastGamma; };
+
+    int planNode = -1; // node of the compiled decay plan, -1 if unknown
+    inline void SetPlanNode(int node) { planNode = node; };
+    inline int GetPlanNode() const { return planNode; };
   };
 
 } // End of CRADLE namespace
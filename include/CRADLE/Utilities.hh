@@ -58,48 +58,40 @@ namespace CRADLE
     const std::string atoms[] = {"H", "He", "Li", "Be", "B", "C", "N", "O", "F", "Ne", "Na", "Mg", "Al", "Si", "P", "S", "Cl", "Ar", "K", "Ca", "Sc", "Ti", "V", "Cr", "Mn", "Fe", "Co", "Ni", "Cu", "Zn", "Ga", "Ge", "As", "Se", "Br", "Kr", "Rb", "Sr", "Y", "Zr", "Nb", "Mo", "Tc", "Ru", "Rh", "Pd", "Ag", "Cd", "In", "Sn", "Sb", "Te", "I", "Xe", "Cs", "Ba", "La", "Ce", "Pr", "Nd", "Pm", "Sm", "Eu", "Gd", "Tb", "Dy", "Ho", "Er", "Tm", "Yb", "Lu", "Hf", "Ta", "W", "Re", "Os", "Ir", "Pt", "Au", "Hg", "Tl", "Pb", "Bi", "Po", "At", "Rn", "Fr", "Ra", "Ac", "Th", "Pa", "U", "Np", "Pu", "Am", "Cm", "Bk", "Cf", "Es", "Fm", "Md", "No", "Lr", "Rf", "Db", "Sg", "Bh", "Hs", "Mt"};
 
     /////// ajout de SL 28/04/2025///////////////////////
-    inline double BreitWigner(double E0, double lifetime, double ProbabilityBoundaries = 1)
+    // Half width (keV) of a level from its lifetime (s), 0 for a stable or unknown level
+    inline double BreitWignerHalfWidth(double lifetime)
+    {
+      if (lifetime <= 0. || lifetime >= 1.e46)
+        return 0.;
+      return utilities::HBAR * log(2.) / lifetime / 1000 / 2;
+    }
+
+    // Cauchy distribution of half width gamma around E0 truncated to the central ProbabilityBoundaries
+    // fraction (to [0, 1e10] if 1) and to positive energies, sampled with the inverse CDF.
+    // The engine must belong to the calling thread.
+    template <class Engine>
+    inline double BreitWigner(double E0, double gamma, Engine &generator, double ProbabilityBoundaries = 1)
     {
-      std::random_device rd;
-      std::mt19937 gen(rd());
       if (ProbabilityBoundaries < 0. || ProbabilityBoundaries > 1.)
       {
         std::cerr << "Error in BreitWigner: ProbabilityBoundaries must be between 0 and 1" << std::endl;
         return E0;
       }
 
-      if (lifetime < 0.)
+      if (gamma <= 0.)
       {
-        std::cerr << "Error in BreitWigner: lifetime must be positive" << std::endl;
         return E0;
       }
 
-      if (lifetime == 0.)
+      double thetaMin = std::max(-M_PI * ProbabilityBoundaries / 2., std::atan(-E0 / gamma));
+      double thetaMax = (ProbabilityBoundaries == 1) ? std::atan((1e10 - E0) / gamma) : M_PI * ProbabilityBoundaries / 2.;
+      if (thetaMin >= thetaMax)
       {
         return E0;
       }
 
-      double E = 0.;
-      double gamma = utilities::HBAR * log(2.) / lifetime / 1000 / 2;
-      // std::cout << "gamma = " << gamma << std::endl;
-      const double a = std::tan(M_PI * ProbabilityBoundaries / 2.0);
-      double Emin = E0 - a * gamma;
-      double Emax = E0 + a * gamma;
-      std::cauchy_distribution<> cauchy(E0, gamma);
-      E = cauchy(gen);
-
-      if (ProbabilityBoundaries == 1)
-      {
-        Emin = 0;
-        Emax = 1e10;
-      }
-
-      while ((E < Emin || E > Emax || E < 0.))
-      {
-        E = cauchy(gen);
-      }
-
-      return E;
+      std::uniform_real_distribution<double> distribution(0., 1.);
+      return E0 + gamma * std::tan(thetaMin + distribution(generator) * (thetaMax - thetaMin));
     }
     /////////////////////////////////////////////////////
 
@@ -194,6 +186,7 @@ namespace CRADLE
 
       if (betaMixingRatioFile.is_open())
       {
+        const std::string parentName = PDGtoName(PDG);
         while (getline(betaMixingRatioFile, line))
         {
           std::string name;
@@ -202,7 +195,7 @@ namespace CRADLE
           std::istringstream iss(line);
           iss >> name >> mixingRatio;
 
-          if (name == PDGtoName(PDG))
+          if (name == parentName)
           {
             if (dm.configOptions.general.Verbosity >= 2)
               Info(Form("Found mixing ratio for %s: %f", name.c_str(), mixingRatio), 2);
@@ -365,6 +358,145 @@ namespace CRADLE
       return 2. * PI * nu / (1. - std::pow(E, -2. * PI * nu));
     }
 
+    //------------------------------------------------------------
+    // Z-only quantities of the beta spectrum corrections
+    // Built once per channel, so that only the W dependent parts
+    // are evaluated at every point of the energy grid
+    //------------------------------------------------------------
+    struct BetaSpectrumContext
+    {
+      int Z = 0;        // daughter charge (positive)
+      int A = 0;        // mass number
+      int betaSign = 0; // betaType convention of the corrections
+      double R = 0.;    // nuclear radius in natural units
+
+      // Fermi function
+      double alphaZ = 0.;
+      double gamma = 0.;
+      double lnGammaNorm = 0.; // ln(Gamma(2 gamma + 1))
+
+      // L0
+      double L0a[7] = {0., 0., 0., 0., 0., 0., 0.};
+      double L0Constant = 0.; // W independent part of common + specific
+      double L0W = 0.;        // coefficient of W in common
+      double L0InvW = 0.;     // coefficient of 1/W in common + specific
+
+      // U
+      double Ua[3] = {0., 0., 0.};
+
+      // Screening
+      double screeningL = 0.; // 2 sum(A_i B_i) of the atomic potential
+
+      // Exchange
+      const std::array<double, 9> *exchangePars = nullptr; // nullptr if no fit for this Z
+    };
+
+    // Each correction only needs part of the context, the scalar
+    // wrappers below fill just the fields they use
+    inline BetaSpectrumContext BetaSpectrumContextBase(int Z, int A, double R, int betaType)
+    {
+      BetaSpectrumContext ctx;
+      ctx.Z = Z;
+      ctx.A = A;
+      ctx.betaSign = betaType;
+      ctx.R = R;
+
+      ctx.alphaZ = FINESTRUCTURE * Z;
+      ctx.gamma = std::sqrt(1. - ctx.alphaZ * ctx.alphaZ);
+      return ctx;
+    }
+
+    inline void BuildL0Context(BetaSpectrumContext &ctx)
+    {
+      static const double bNeg[7][6] = {{0.115, -1.8123, 8.2498, -11.223, -14.854, 32.086},
+                                        {-0.00062, 0.007165, 0.01841, -0.53736, 1.2691, -1.5467},
+                                        {0.02482, -0.5975, 4.84199, -15.3374, 23.9774, -12.6534},
+                                        {-0.14038, 3.64953, -38.8143, 172.1368, -346.708, 288.7873},
+                                        {0.008152, -1.15664, 49.9663, -273.711, 657.8292, -603.7033},
+                                        {1.2145, -23.9931, 149.9718, -471.2985, 662.1909, -305.6804},
+                                        {-1.5632, 33.4192, -255.1333, 938.5297, -1641.2845, 1095.358}};
+
+      static const double bPos[7][6] = {{0.0701, -2.572, 27.5971, -128.658, 272.264, -214.925},
+                                        {-0.002308, 0.066463, -0.6407, 2.63606, -5.6317, 4.0011},
+                                        {0.07936, -2.09284, 18.45462, -80.9375, 160.8384, -124.8927},
+                                        {-0.93832, 22.02513, -197.00221, 807.1878, -1566.6077, 1156.3287},
+                                        {4.276181, -96.82411, 835.26505, -3355.8441, 6411.3255, -4681.573},
+                                        {-8.2135, 179.0862, -1492.1295, 5872.5362, -11038.7299, 7963.4701},
+                                        {5.4583, -115.8922, 940.8305, -3633.9181, 6727.6296, -4795.0481}};
+
+      int betaType = ctx.betaSign;
+      double R = ctx.R;
+
+      const double(*b)[6] = (betaType == 1) ? bPos : bNeg;
+      for (int n = 0; n <= 6; n++)
+      {
+        ctx.L0a[n] = 0.;
+        double alphaZx = 1.;
+        for (int x = 1; x <= 6; x++)
+        {
+          alphaZx *= ctx.alphaZ;
+          ctx.L0a[n] += b[n][x - 1] * alphaZx;
+        }
+      }
+
+      double gamma = ctx.gamma;
+      double norm = 2. / (1. + gamma);
+      ctx.L0Constant = norm * (1. + 13. / 60. * ctx.alphaZ * ctx.alphaZ +
+                               ((betaType == 1) ? 0.22 : 0.41) * (R - 0.0164) * std::pow(ctx.alphaZ, 4.5));
+      ctx.L0W = -norm * betaType * R * ctx.alphaZ * (41. - 26. * gamma) / 15. / (2. * gamma - 1);
+      ctx.L0InvW = norm * (ctx.L0a[0] * R - betaType * ctx.alphaZ * R * gamma * (17. - 2. * gamma) / 30. / (2. * gamma - 1));
+    }
+
+    inline void BuildUContext(BetaSpectrumContext &ctx)
+    {
+      int Z = ctx.Z;
+      int betaType = ctx.betaSign;
+      ctx.Ua[0] = -5.6E-5 - betaType * 4.94E-5 * Z + 6.23E-8 * std::pow(Z, 2);
+      ctx.Ua[1] = 5.17E-6 + betaType * 2.517E-6 * Z + 2.00E-8 * std::pow(Z, 2);
+      ctx.Ua[2] = -9.17e-8 + betaType * 5.53E-9 * Z + 1.25E-10 * std::pow(Z, 2);
+    }
+
+    inline void BuildScreeningContext(BetaSpectrumContext &ctx)
+    {
+      // No atomic electrons screen the nucleus for Z - betaType < 1 (e.g. the neutron),
+      // screeningL stays 0 and the screening correction is 1
+      int Zscreening = ctx.Z - ctx.betaSign;
+      if (Zscreening < 1)
+      {
+        ctx.screeningL = 0.;
+        return;
+      }
+      screening::PotentialParameters pot = screening::GetPotentialParameters(Zscreening);
+      ctx.screeningL = 2 * (pot.A[0] * pot.B[0] + pot.A[1] * pot.B[1] + pot.A[2] * pot.B[2]);
+    }
+
+    inline BetaSpectrumContext BuildBetaSpectrumContext(int Z, int A, double R, int betaType)
+    {
+      BetaSpectrumContext ctx = BetaSpectrumContextBase(Z, A, R, betaType);
+      ctx.lnGammaNorm = gsl_sf_lngamma(2. * ctx.gamma + 1.);
+
+      BuildL0Context(ctx);
+      BuildUContext(ctx);
+      BuildScreeningContext(ctx);
+
+      ctx.exchangePars = screening::GetAtomicExchangeFitParameters(Z);
+
+      return ctx;
+    }
+
+    inline double FermiFunction(double W, const BetaSpectrumContext &ctx)
+    {
+      double p = std::sqrt(W * W - 1.);
+      double y = ctx.betaSign * ctx.alphaZ * W / p;
+
+      gsl_sf_result magn;
+      gsl_sf_result phase;
+      gsl_sf_lngamma_complex_e(ctx.gamma, y, &magn, &phase);
+
+      return 2. * (ctx.gamma + 1.) * std::pow(2. * p * ctx.R, 2. * (ctx.gamma - 1.)) *
+             std::exp(M_PI * y + 2. * (magn.val - ctx.lnGammaNorm));
+    }
+
     inline double FermiFunction(int Z, double W, double R, int betaType)
     {
       double gamma = std::sqrt(1. - std::pow(FINESTRUCTURE * Z, 2.));
@@ -389,82 +521,47 @@ namespace CRADLE
       return result;
     }
 
-    inline double L0Correction(double W, int Z, double r, int betaType)
-    { /////////// L0 Correction ---- L0 (voir specific, ajouter le sum)
-      // double aPos[], double aNeg[]) {
-      double gamma = std::sqrt(1. - std::pow(FINESTRUCTURE * Z, 2.));
-      double sum = 0;
-      double common = 0;
-      double specific = 0;
-
-      /////////////////////// Completion du code SL 10/05/2023
-      double bNeg[7][6] = {{0.115, -1.8123, 8.2498, -11.223, -14.854, 32.086},
-                           {-0.00062, 0.007165, 0.01841, -0.53736, 1.2691, -1.5467},
-                           {0.02482, -0.5975, 4.84199, -15.3374, 23.9774, -12.6534},
-                           {-0.14038, 3.64953, -38.8143, 172.1368, -346.708, 288.7873},
-                           {0.008152, -1.15664, 49.9663, -273.711, 657.8292, -603.7033},
-                           {1.2145, -23.9931, 149.9718, -471.2985, 662.1909, -305.6804},
-                           {-1.5632, 33.4192, -255.1333, 938.5297, -1641.2845, 1095.358}};
-      double aNeg[7] = {0, 0, 0, 0, 0, 0, 0};
-
-      double bPos[7][6] = {{0.0701, -2.572, 27.5971, -128.658, 272.264, -214.925},
-                           {-0.002308, 0.066463, -0.6407, 2.63606, -5.6317, 4.0011},
-                           {0.07936, -2.09284, 18.45462, -80.9375, 160.8384, -124.8927},
-                           {-0.93832, 22.02513, -197.00221, 807.1878, -1566.6077, 1156.3287},
-                           {4.276181, -96.82411, 835.26505, -3355.8441, 6411.3255, -4681.573},
-                           {-8.2135, 179.0862, -1492.1295, 5872.5362, -11038.7299, 7963.4701},
-                           {5.4583, -115.8922, 940.8305, -3633.9181, 6727.6296, -4795.0481}};
-      double aPos[7] = {0, 0, 0, 0, 0, 0, 0};
-
-      for (int n = 0; n <= 6; n++)
-      {
-        for (int x = 1; x <= 6; x++)
-        {
-          if (betaType == 1)
-            aPos[n] += bPos[n][x - 1] * std::pow(FINESTRUCTURE * Z, x);
-          else
-            aNeg[n] += bNeg[n][x - 1] * std::pow(FINESTRUCTURE * Z, x);
-        }
-      }
-
-      for (int i = 1; i < 7; i++)
-      {
-        if (betaType == 1)
-          sum += aPos[i] * std::pow(W * r, i - 1);
-        else
-          sum += aNeg[i] * std::pow(W * r, i - 1);
-      }
-
-      if (betaType == 1)
-        specific = aPos[0] * r / W + 0.22 * (r - 0.0164) * std::pow(FINESTRUCTURE * Z, 4.5) + sum;
-      else
-        specific = aNeg[0] * r / W + 0.41 * (r - 0.0164) * std::pow(FINESTRUCTURE * Z, 4.5) + sum;
-      ///////////////////////
+    inline double L0Correction(double W, const BetaSpectrumContext &ctx)
+    { /////////// L0 Correction ---- L0
+      // sum_{i=1..6} a_i (W R)^(i-1), Horner scheme
+      double WR = W * ctx.R;
+      double sum = 0.;
+      for (int i = 6; i >= 1; i--)
+        sum = sum * WR + ctx.L0a[i];
 
-      common = (1. + 13. / 60. * std::pow(FINESTRUCTURE * Z, 2) -
-                betaType * W * r * FINESTRUCTURE * Z * (41. - 26. * gamma) / 15. / (2. * gamma - 1)) -
-               betaType * FINESTRUCTURE * Z * r * gamma * (17. - 2. * gamma) / 30. / W /
-                   (2. * gamma - 1);
+      return ctx.L0Constant + ctx.L0W * W + ctx.L0InvW / W + 2. / (1. + ctx.gamma) * sum;
+    }
 
-      return (common + specific) * 2. / (1. + gamma);
+    inline double L0Correction(double W, int Z, double r, int betaType)
+    {
+      BetaSpectrumContext ctx = BetaSpectrumContextBase(Z, 0, r, betaType);
+      BuildL0Context(ctx);
+      return L0Correction(W, ctx);
     }
 
-    inline double UCorrection(double W, int Z, int betaType)
+    inline double UCorrection(double W, const BetaSpectrumContext &ctx)
     { //////////////U Correction ----- U (OK)
-      double result = 1.;
-      double a0 = -5.6E-5 - betaType * 4.94E-5 * Z + 6.23E-8 * std::pow(Z, 2);
-      double a1 = 5.17E-6 + betaType * 2.517E-6 * Z + 2.00E-8 * std::pow(Z, 2);
-      double a2 = -9.17e-8 + betaType * 5.53E-9 * Z + 1.25E-10 * std::pow(Z, 2);
-
       double p = std::sqrt(W * W - 1);
+      return 1. + ctx.Ua[0] + ctx.Ua[1] * p + ctx.Ua[2] * p * p;
+    }
 
-      result = 1. + a0 + a1 * p + a2 * p * p;
-
-      return result;
+    inline double UCorrection(double W, int Z, int betaType)
+    {
+      BetaSpectrumContext ctx = BetaSpectrumContextBase(Z, 0, 0., betaType);
+      BuildUContext(ctx);
+      return UCorrection(W, ctx);
     }
 
-    inline std::tuple<double, double> CCorrectionComponents( ////////Shape Factor ----- C (OK)
-        double W, double W0, int Z, int A, double R, int betaType, int decayType,
+    // Shape factor C(W) = c0 + c1 W + cm1 / W + c2 W^2, split into the
+    // shape part and the nuclear structure part (order c0, c1, cm1, c2)
+    struct CCorrectionCoefficients
+    {
+      double shape[4] = {0., 0., 0., 0.};
+      double ns[4] = {0., 0., 0., 0.};
+    };
+
+    inline CCorrectionCoefficients GetCCorrectionCoefficients( ////////Shape Factor ----- C (OK)
+        double W0, int Z, int A, double R, int betaType, int decayType,
         double gA, double gP, double fc1, double fb, double fd,
         double ratioM121, double mixingRatio)
     {
@@ -509,23 +606,27 @@ namespace CRADLE
       AC2 = -4. / 9. * R * R * (1 - 1./10. * Lambda); ;
       // 
 
-      double cShape = 0.;
+      CCorrectionCoefficients coef;
 
       if (decayType == FERMI)
       {
-        cShape = 1. + VC0 + VC1 * W + VCm1 / W + VC2 * W * W;
+        double shape[4] = {1. + VC0, VC1, VCm1, VC2};
+        std::copy(shape, shape + 4, coef.shape);
       }
       else if (decayType == GAMOW_TELLER)
       {
-        cShape = 1. + AC0 + AC1 * W + ACm1 / W + AC2 * W * W;
+        double shape[4] = {1. + AC0, AC1, ACm1, AC2};
+        std::copy(shape, shape + 4, coef.shape);
       }
       else if (decayType == MIXED)
       {
-        cShape = 1. + 1 / (1 + std::pow(mixingRatio, 2.)) * (VC0 + VC1 * W + VCm1 / W + VC2 * W * W) + std::pow(mixingRatio, 2.) / (1 + std::pow(mixingRatio, 2.)) * (AC0 + AC1 * W + ACm1 / W + AC2 * W * W);
+        double fermiWeight = 1 / (1 + std::pow(mixingRatio, 2.));
+        double gtWeight = std::pow(mixingRatio, 2.) / (1 + std::pow(mixingRatio, 2.));
+        double shape[4] = {1. + fermiWeight * VC0 + gtWeight * AC0, fermiWeight * VC1 + gtWeight * AC1,
+                           fermiWeight * VCm1 + gtWeight * ACm1, fermiWeight * VC2 + gtWeight * AC2};
+        std::copy(shape, shape + 4, coef.shape);
       }
 
-      double cNS = 0;
-
       if (decayType == GAMOW_TELLER || decayType == MIXED)
       {
         double M = A * NMASSC2 / EMASSC2;
@@ -553,16 +654,29 @@ namespace CRADLE
         double P1 = betaType * 2. / 25. * FINESTRUCTURE * Z * R;
         double Pm1 = -2. / 3. * gamma * W0 * R * R + betaType * 26. / 25. * FINESTRUCTURE * Z * R * gamma;
 
-        cNS = NSC0 + NSC1 * W + NSCm1 / W + NSC2 * W * W;
-
-        cNS += phi * (P0 + P1 * W + Pm1 / W);
+        double ns[4] = {NSC0 + phi * P0, NSC1 + phi * P1, NSCm1 + phi * Pm1, NSC2};
+        std::copy(ns, ns + 4, coef.ns);
       }
 
       if (decayType == MIXED)
       {
-        cNS = std::pow(mixingRatio, 2.) / (1 + std::pow(mixingRatio, 2.)) * cNS;
+        for (int k = 0; k < 4; k++)
+          coef.ns[k] *= std::pow(mixingRatio, 2.) / (1 + std::pow(mixingRatio, 2.));
       }
 
+      return coef;
+    }
+
+    inline std::tuple<double, double> CCorrectionComponents(
+        double W, double W0, int Z, int A, double R, int betaType, int decayType,
+        double gA, double gP, double fc1, double fb, double fd,
+        double ratioM121, double mixingRatio)
+    {
+      CCorrectionCoefficients coef = GetCCorrectionCoefficients(W0, Z, A, R, betaType, decayType, gA, gP, fc1, fb, fd, ratioM121, mixingRatio);
+
+      double cShape = coef.shape[0] + coef.shape[1] * W + coef.shape[2] / W + coef.shape[3] * W * W;
+      double cNS = coef.ns[0] + coef.ns[1] * W + coef.ns[2] / W + coef.ns[3] * W * W;
+
       return std::make_tuple(cShape, cNS);
     }
 
@@ -686,14 +800,13 @@ namespace CRADLE
       return 1;
     }
 
-    inline double AtomicScreeningCorrection(double W, int Z, ///////// Atomic Screening ------- S (OK mais pas utilisé)
-                                            int betaType)
-    {
-      std::vector<double> Aby, Bby;
-
-      screening::PotParam(Z - 1 * betaType, Aby, Bby);
-
-      double l = 2 * (Aby[0] * Bby[0] + Aby[1] * Bby[1] + Aby[2] * Bby[2]);
+    inline double AtomicScreeningCorrection(double W, const BetaSpectrumContext &ctx)
+    { ///////// Atomic Screening ------- S (OK mais pas utilisé)
+      if (ctx.screeningL == 0.)
+        return 1.; // no atomic electrons
+      int Z = ctx.Z;
+      int betaType = ctx.betaSign;
+      double l = ctx.screeningL;
 
       double p = std::sqrt(W * W - 1);
 
@@ -708,11 +821,7 @@ namespace CRADLE
       double y = betaType * FINESTRUCTURE * Z * W / p;
       std::complex<double> yt = betaType * FINESTRUCTURE * Z * Wt / pt;
 
-      double gamma = std::sqrt(1. - pow(FINESTRUCTURE * Z, 2.));
-
-      /*cout << "V: " << W-Wt << endl;
-      cout << W << " " << yt.real() << " " << yt.imag() << endl;
-      cout << W << " " << pt.real() << " " << pt.imag() << endl;*/
+      double gamma = ctx.gamma;
 
       gsl_sf_result magn;
       gsl_sf_result phase;
@@ -736,13 +845,21 @@ namespace CRADLE
       return first * second * third * fourth * fifth;
     }
 
+    inline double AtomicScreeningCorrection(double W, int Z, int betaType)
+    {
+      BetaSpectrumContext ctx = BetaSpectrumContextBase(Z, 0, 0., betaType);
+      BuildScreeningContext(ctx);
+      return AtomicScreeningCorrection(W, ctx);
+    }
+
     // modified by SL 10/05/2023
-    inline double AtomicExchangeCorrection(double W, int Z)
+    inline double AtomicExchangeCorrection(double W, const BetaSpectrumContext &ctx)
     { ///////////// ATOMIC EXCHNAGE -------- X (crée par SL 10/05/2023)
-      double E = W - 1;
+      if (!ctx.exchangePars)
+        return 1.; // no fit available for this Z
+      const std::array<double, 9> &exPars = *ctx.exchangePars;
 
-      std::vector<double> exPars;
-      screening::AtomicExchangeFitParams(Z, exPars);
+      double E = W - 1;
 
       return 1 + exPars[0] / E + exPars[1] / E / E +
              exPars[2] * std::exp(-exPars[3] * E) +
@@ -750,6 +867,13 @@ namespace CRADLE
                  std::pow(W, exPars[8]);
     }
 
+    inline double AtomicExchangeCorrection(double W, int Z)
+    {
+      BetaSpectrumContext ctx;
+      ctx.exchangePars = screening::GetAtomicExchangeFitParameters(Z);
+      return AtomicExchangeCorrection(W, ctx);
+    }
+
     inline double AtomicMismatchCorrection(double W, double W0, int Z, ///////////ATOMIC OVERLAP ------ r (OK mais pas utilisé)
                                            int A, int betaType)
     {
@@ -781,45 +905,484 @@ namespace CRADLE
       return (1.15 + 1.8 * std::pow(A, -2. / 3.) - 1.2 * std::pow(A, -4. / 3.)) * std::pow(A, 1. / 3.) * 1.E-15;
     }
 
-    inline double GetSpectrumHeight(int Z, int A, double Q, double E, bool advanced, int decayType, double mf, double mgt, double mixing_ratio)
+    //------------------------------------------------------------
+    // Batch evaluation of the corrections on an array of total energies W
+    // W independent quantities are computed once per call and the
+    // per point work is written as plain loops over contiguous arrays,
+    // the complex log-gamma from GSL being kept in a separate loop
+    // only where no closed form exists. Temporaries live on the stack
+    // and the arrays are processed in chunks of BATCH_SIZE points.
+    //------------------------------------------------------------
+    const std::size_t BATCH_SIZE = 256;
+
+    // Re ln Gamma(1 + i x) = 0.5 ln(pi x / sinh(pi x)), x > 0
+    inline double LogGammaOnePlusImaginary(double x)
+    {
+      double pix = M_PI * x;
+      return 0.5 * (std::log(pix) - pix - std::log(-std::expm1(-2. * pix)) + M_LN2);
+    }
+
+    inline void FermiFunction(const double *W, double *F, std::size_t n, const BetaSpectrumContext &ctx)
+    {
+      double p[BATCH_SIZE], y[BATCH_SIZE], lnGamma[BATCH_SIZE];
+      double front = 2. * (ctx.gamma + 1.);
+      double powerExponent = 2. * (ctx.gamma - 1.);
+      double yFactor = ctx.betaSign * ctx.alphaZ;
+
+      for (std::size_t start = 0; start < n; start += BATCH_SIZE)
+      {
+        std::size_t m = std::min(BATCH_SIZE, n - start);
+        const double *w = W + start;
+
+        for (std::size_t i = 0; i < m; ++i)
+        {
+          p[i] = std::sqrt(w[i] * w[i] - 1.);
+          y[i] = yFactor * w[i] / p[i];
+        }
+
+        for (std::size_t i = 0; i < m; ++i)
+        {
+          gsl_sf_result magn;
+          gsl_sf_result phase;
+          gsl_sf_lngamma_complex_e(ctx.gamma, y[i], &magn, &phase);
+          lnGamma[i] = magn.val;
+        }
+
+        for (std::size_t i = 0; i < m; ++i)
+          F[start + i] = front * std::exp(powerExponent * std::log(2. * p[i] * ctx.R) + M_PI * y[i] +
+                                          2. * (lnGamma[i] - ctx.lnGammaNorm));
+      }
+    }
+
+    inline void L0Correction(const double *W, double *L0, std::size_t n, const BetaSpectrumContext &ctx)
+    {
+      double a[7];
+      for (int k = 1; k <= 6; k++)
+        a[k] = 2. / (1. + ctx.gamma) * ctx.L0a[k];
+
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        double WR = W[i] * ctx.R;
+        double sum = ((((a[6] * WR + a[5]) * WR + a[4]) * WR + a[3]) * WR + a[2]) * WR + a[1];
+        L0[i] = ctx.L0Constant + ctx.L0W * W[i] + ctx.L0InvW / W[i] + sum;
+      }
+    }
+
+    inline void UCorrection(const double *W, double *U, std::size_t n, const BetaSpectrumContext &ctx)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        double p = std::sqrt(W[i] * W[i] - 1);
+        U[i] = 1. + ctx.Ua[0] + ctx.Ua[1] * p + ctx.Ua[2] * p * p;
+      }
+    }
+
+    inline void CCorrection(const double *W, double *C, std::size_t n,
+                            double W0, int Z, int A, double R, int betaType, int decayType,
+                            double gA, double gP, double fc1, double fb, double fd,
+                            double ratioM121, double mixingRatio)
+    {
+      CCorrectionCoefficients coef = GetCCorrectionCoefficients(W0, Z, A, R, betaType, decayType, gA, gP, fc1, fb, fd, ratioM121, mixingRatio);
+      double c[4];
+      for (int k = 0; k < 4; k++)
+        c[k] = coef.shape[k] + coef.ns[k];
+
+      for (std::size_t i = 0; i < n; ++i)
+        C[i] = c[0] + (c[1] + c[3] * W[i]) * W[i] + c[2] / W[i];
+    }
+
+    inline void AtomicScreeningCorrection(const double *W, double *S, std::size_t n, const BetaSpectrumContext &ctx)
+    {
+      double p[BATCH_SIZE], y[BATCH_SIZE], Wt[BATCH_SIZE];
+      double ptRe[BATCH_SIZE], ptIm[BATCH_SIZE], ytRe[BATCH_SIZE], ytIm[BATCH_SIZE];
+      double lnGamma[BATCH_SIZE];
+
+      if (ctx.screeningL == 0.)
+      {
+        std::fill(S, S + n, 1.); // no atomic electrons
+        return;
+      }
+
+      int Z = ctx.Z;
+      int betaType = ctx.betaSign;
+      double l = ctx.screeningL;
+      double gamma = ctx.gamma;
+      double shift = betaType * 0.5 * FINESTRUCTURE * (Z - betaType) * l;
+      double ptFactor = betaType * 2 * FINESTRUCTURE * Z * l;
+      double yFactor = betaType * FINESTRUCTURE * Z;
+
+      for (std::size_t start = 0; start < n; start += BATCH_SIZE)
+      {
+        std::size_t m = std::min(BATCH_SIZE, n - start);
+        const double *w = W + start;
+
+        for (std::size_t i = 0; i < m; ++i)
+        {
+          p[i] = std::sqrt(w[i] * w[i] - 1);
+          Wt[i] = w[i] - shift;
+          y[i] = yFactor * w[i] / p[i];
+
+          // pt = (p + sqrt(p^2 - ptFactor Wt)) / 2, the root is real or imaginary
+          double d = p[i] * p[i] - ptFactor * Wt[i];
+          double root = std::sqrt(std::abs(d));
+          ptRe[i] = 0.5 * p[i] + (d >= 0. ? 0.5 * root : 0.);
+          ptIm[i] = (d >= 0. ? 0. : 0.5 * root);
+
+          // yt = yFactor Wt / pt
+          double norm2 = ptRe[i] * ptRe[i] + ptIm[i] * ptIm[i];
+          ytRe[i] = yFactor * Wt[i] * ptRe[i] / norm2;
+          ytIm[i] = -yFactor * Wt[i] * ptIm[i] / norm2;
+        }
+
+        // no closed form for these three, Re ln Gamma(1 + 2ip/l) is done analytically below
+        for (std::size_t i = 0; i < m; ++i)
+        {
+          gsl_sf_result magn, phase, magnT, phaseT, magnT2, phaseT2;
+          gsl_sf_lngamma_complex_e(gamma, y[i], &magn, &phase);
+          gsl_sf_lngamma_complex_e(gamma - ytIm[i], ytRe[i], &magnT, &phaseT);
+          gsl_sf_lngamma_complex_e(gamma - 2 * ptIm[i] / l, 2 * ptRe[i] / l, &magnT2, &phaseT2);
+          lnGamma[i] = magnT.val - magn.val + magnT2.val;
+        }
+
+        for (std::size_t i = 0; i < m; ++i)
+        {
+          double x = 2 * p[i] / l;
+          S[start + i] = Wt[i] / w[i] *
+                         std::exp(2 * (lnGamma[i] - LogGammaOnePlusImaginary(x)) - M_PI * y[i] +
+                                  2 * (1 - gamma) * std::log(x));
+        }
+      }
+    }
+
+    inline void AtomicExchangeCorrection(const double *W, double *X, std::size_t n, const BetaSpectrumContext &ctx)
+    {
+      if (!ctx.exchangePars)
+      {
+        std::fill(X, X + n, 1.); // no fit available for this Z
+        return;
+      }
+      const std::array<double, 9> &exPars = *ctx.exchangePars;
+
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        double E = W[i] - 1;
+        X[i] = 1 + exPars[0] / E + exPars[1] / E / E +
+               exPars[2] * std::exp(-exPars[3] * E) +
+               exPars[4] * sin(std::pow(W[i] - exPars[6], exPars[5]) + exPars[7]) /
+                   std::pow(W[i], exPars[8]);
+      }
+    }
+
+    inline void RadiativeCorrection(const double *W, double *Rad, std::size_t n, double W0, int Z,
+                                    double R, double gA, double gM)
+    {
+      // W independent parts, see the scalar version
+      double logMassRatio = std::log(PMASSC2 / EMASSC2);
+      double O1Constant = 3. * logMassRatio - 0.75 - 3. * std::log(PMASSC2 / EMASSC2 / 2. / W0);
+      double L = 1.026725 * std::pow(1. - 2. * FINESTRUCTURE / 3. / M_PI * std::log(2. * W0), 9. / 4.);
+
+      double lambda = std::sqrt(10) / R;
+      double lambdaOverM = lambda / NMASSC2 * EMASSC2;
+      double d1f = std::log(lambdaOverM) - EULER_MASCHERONI_CONSTANT + 4. / 3. -
+                   std::log(std::sqrt(10.0)) -
+                   3.0 / M_PI / std::sqrt(10.0) * lambdaOverM * (0.5 + EULER_MASCHERONI_CONSTANT + std::log(std::sqrt(10) / lambdaOverM));
+      double d2 = 3.0 / 2.0 / M_PI / std::sqrt(10.0) * lambdaOverM *
+                  (1. - M_PI / 2. / std::sqrt(10) * lambdaOverM);
+      double d3 = 3.0 * gA * gM / M_PI / std::sqrt(10.0) * lambdaOverM *
+                  (EULER_MASCHERONI_CONSTANT - 1. + std::log(std::sqrt(10) / lambdaOverM) +
+                   M_PI / 4 / std::sqrt(10) * lambdaOverM);
+      double O2Constant = logMassRatio + 43. / 18. + d1f + d2 + d3;
+
+      double a = 0.5697;
+      double b = 4. / 3. / M_PI * (11. / 4. - EULER_MASCHERONI_CONSTANT - M_PI * M_PI / 6);
+      double logR = std::log(R);
+      double logLambda = std::log(lambda);
+      double O3Constant = -0.649 * std::log(2 * W0);
+      double O3Factor = std::pow(FINESTRUCTURE, 3) * std::pow(Z, 2);
+
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        double w = W[i];
+        double beta = std::sqrt(1.0 - 1.0 / w / w);
+        double atanhBeta = std::atanh(beta);
+        double log2W = std::log(2 * w);
+
+        // dilogarithm from GSL, no fast path
+        double g = O1Constant + 4.0 / beta * Spence(2. * beta / (1. + beta)) +
+                   4. * (atanhBeta / beta - 1.) * ((W0 - w) / 3. / w - 1.5 + std::log(2 * (W0 - w))) +
+                   atanhBeta / beta * (2. * (1. + beta * beta) + (W0 - w) * (W0 - w) / 6. / w / w - 4. * atanhBeta);
+        double O1corr = FINESTRUCTURE / 2. / M_PI * g;
+
+        double O2corr = FINESTRUCTURE * FINESTRUCTURE * Z * (O2Constant - 5. / 3. * log2W);
+
+        double g2 = 0.5 * (logR * logR - log2W * log2W) + 5. / 3. * (logR + log2W);
+        double O3corr = O3Factor * (a * (logLambda - std::log(w)) + b * (log2W - 5. / 6.) + 4. / M_PI / 3. * g2 + O3Constant);
+
+        Rad[i] = (1 + O1corr) * (L + O2corr + O3corr);
+      }
+    }
+
+    inline void RecoilCorrection(const double *W, double *Rn, std::size_t n, double W0, int A,
+                                 int decayType, double mixingRatio)
+    {
+      double M = A * (PMASSC2 + NMASSC2) / 2. / EMASSC2;
+      double M2 = M * M;
+
+      double Ar[4] = {-2. * W0 / 3. / M - W0 * W0 / 6. / M2 - 77. / 18. / M2,
+                      -2. / 3. / M + 7. * W0 / 9. / M2,
+                      10. / 3. / M - 28. * W0 / 9. / M2,
+                      88. / 9. / M2};
+      double Vr[4] = {W0 * W0 / 2. / M2 - 11. / 6. / M2,
+                      W0 / 3. / M2,
+                      2. / M - 4. * W0 / 3. / M2,
+                      16. / 3. / M2};
+
+      // 1 + c0 + c1 / W + c2 W + c3 W^2
+      double c[4] = {0., 0., 0., 0.};
+      for (int k = 0; k < 4; k++)
+      {
+        if (decayType == FERMI)
+          c[k] = Vr[k];
+        else if (decayType == GAMOW_TELLER)
+          c[k] = Ar[k];
+        else if (mixingRatio != 0)
+          c[k] = 1. / (1 + std::pow(mixingRatio, 2)) * Vr[k] + 1. / (1 + 1. / std::pow(mixingRatio, 2)) * Ar[k];
+      }
+
+      for (std::size_t i = 0; i < n; ++i)
+        Rn[i] = 1 + c[0] + c[1] / W[i] + (c[2] + c[3] * W[i]) * W[i];
+    }
+
+    inline void AtomicMismatchCorrection(const double *W, double *r, std::size_t n, double W0, int Z,
+                                         int A, int betaType)
+    {
+      double dBdZ2 = (44.200 * std::pow(Z - betaType, 0.41) +
+                      2.3196E-7 * std::pow(Z - betaType, 4.45)) /
+                     EMASSC2 / 1000.;
+      double K = -0.872 + 1.270 * std::pow(Z, 0.097) + 9.062E-11 * std::pow(Z, 4.5);
+      double M = A * (PMASSC2 + NMASSC2) / 2. / EMASSC2;
+      double vR = std::sqrt(1 - M * M / (M * M + (W0 * W0 - 1) / 4.));
+      double alpha3Z = FINESTRUCTURE * FINESTRUCTURE * Z * FINESTRUCTURE;
+      double alpha2ZvR = 2 * FINESTRUCTURE * FINESTRUCTURE * Z * vR;
+
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        double vp = std::sqrt(1 - 1 / W[i] / W[i]);
+        double l = 1.83E-3 * K * Z / vp;
+        double atanInvL = std::atan(1 / l);
+        double psi2 = 1 + 2 * FINESTRUCTURE / vp * (atanInvL - l / 2 / (1 + l * l));
+        double C0 = -alpha3Z / vp * l / (1 + l * l) / psi2;
+        double C1 = alpha2ZvR / vp * ((0.5 + l * l) / (1 + l * l) - l * atanInvL) / psi2;
+        r[i] = 1 - 2 / (W0 - W[i]) * (0.5 * dBdZ2 + 2 * (C0 + C1));
+      }
+    }
+
+    inline void QCorrection(const double *W, double *Q, std::size_t n, double W0, int Z, int A,
+                            int betaType, double mf, double mgt)
+    {
+      // a(W) = a0 + aCoulomb alpha Z / p
+      double a0, aCoulomb;
+      correlation::CalculateBetaNeutrinoAsymmetryTerms(mf, mgt, betaType, a0, aCoulomb);
+
+      double M = A * (PMASSC2 + NMASSC2) / 2. / EMASSC2;
+      double alphaZ = FINESTRUCTURE * Z;
+
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        double p = std::sqrt(W[i] * W[i] - 1.);
+        double a = a0 + aCoulomb * alphaZ / p;
+        Q[i] = 1. - betaType * M_PI * alphaZ / M / p * (1. + a * (W0 - W[i]) / 3. / M);
+      }
+    }
+
+    //------------------------------------------------------------
+    // Beta spectrum shape pipeline
+    // Each correction is one bit of the selection and one compile-time
+    // specialised pass over the energy grid, the passes of the selected
+    // corrections are chained on the same shape array
+    //------------------------------------------------------------
+    enum SpectrumCorrection : unsigned
+    {
+      CORRECTION_F = 1u << 0,  // Fermi function
+      CORRECTION_L0 = 1u << 1, // finite size of the nucleus
+      CORRECTION_C = 1u << 2,  // shape factor (and nuclear structure)
+      CORRECTION_U = 1u << 3,  // non uniform charge distribution
+      CORRECTION_S = 1u << 4,  // atomic screening
+      CORRECTION_X = 1u << 5,  // atomic exchange
+      CORRECTION_R = 1u << 6,  // radiative
+      CORRECTION_RN = 1u << 7, // recoil
+      CORRECTION_r = 1u << 8,  // atomic mismatch
+      CORRECTION_Q = 1u << 9,  // recoiling Coulomb field
+      CORRECTION_ALL = (1u << 10) - 1
+    };
+
+    // Transition dependent inputs of the corrections
+    struct SpectrumTransition
+    {
+      double W0 = 0.;
+      int decayType = 0;
+      double mf = 0.;
+      double mgt = 0.;
+      double mixingRatio = 0.;
+    };
+
+    // Correction factors on an energy array, one batch function per correction
+    template <unsigned Correction>
+    inline void SpectrumCorrectionFactors(const BetaSpectrumContext &ctx, const SpectrumTransition &tr, const double *W, double *factor, std::size_t n)
+    {
+      if constexpr (Correction == CORRECTION_F)
+        FermiFunction(W, factor, n, ctx);
+      else if constexpr (Correction == CORRECTION_L0)
+        L0Correction(W, factor, n, ctx);
+      else if constexpr (Correction == CORRECTION_C)
+        CCorrection(W, factor, n, tr.W0, ctx.Z, ctx.A, ctx.R, ctx.betaSign, tr.decayType, -LAMBDA, -229, 1, 4. * ctx.A, 1. * ctx.A, 0, 0);
+      else if constexpr (Correction == CORRECTION_U)
+        UCorrection(W, factor, n, ctx);
+      else if constexpr (Correction == CORRECTION_S)
+        AtomicScreeningCorrection(W, factor, n, ctx);
+      else if constexpr (Correction == CORRECTION_X)
+        AtomicExchangeCorrection(W, factor, n, ctx);
+      else if constexpr (Correction == CORRECTION_R)
+        RadiativeCorrection(W, factor, n, tr.W0, ctx.Z, ctx.R, 1.27, 4.706);
+      else if constexpr (Correction == CORRECTION_RN)
+        RecoilCorrection(W, factor, n, tr.W0, ctx.A, tr.decayType, tr.mixingRatio);
+      else if constexpr (Correction == CORRECTION_r)
+        AtomicMismatchCorrection(W, factor, n, tr.W0, ctx.Z, ctx.A, ctx.betaSign);
+      else
+        QCorrection(W, factor, n, tr.W0, ctx.Z, ctx.A, ctx.betaSign, tr.mf, tr.mgt);
+    }
+
+    template <unsigned Correction>
+    inline void ApplySpectrumCorrection(const BetaSpectrumContext &ctx, const SpectrumTransition &tr, const double *W, double *shape, std::size_t n)
+    {
+      double factor[BATCH_SIZE];
+      for (std::size_t start = 0; start < n; start += BATCH_SIZE)
+      {
+        std::size_t m = std::min(BATCH_SIZE, n - start);
+        SpectrumCorrectionFactors<Correction>(ctx, tr, W + start, factor, m);
+        for (std::size_t i = 0; i < m; ++i)
+          shape[start + i] *= factor[i];
+      }
+    }
+
+    template <unsigned... Corrections>
+    inline void ApplySpectrumCorrections(unsigned corrections, const BetaSpectrumContext &ctx, const SpectrumTransition &tr, const double *W, double *shape, std::size_t n)
+    {
+      ((corrections & Corrections ? ApplySpectrumCorrection<Corrections>(ctx, tr, W, shape, n) : void()), ...);
+    }
+
+    // Phase space times the selected corrections on a grid of total energies W
+    inline void SpectrumShape(unsigned corrections, const BetaSpectrumContext &ctx, const SpectrumTransition &tr, const double *W, double *shape, std::size_t n)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        shape[i] = PhaseSpace(W[i], tr.W0);
+
+      ApplySpectrumCorrections<CORRECTION_F, CORRECTION_L0, CORRECTION_C, CORRECTION_U, CORRECTION_S,
+                               CORRECTION_X, CORRECTION_R, CORRECTION_RN, CORRECTION_r, CORRECTION_Q>(corrections, ctx, tr, W, shape, n);
+    }
+
+    // Correction set from a list of tags, e.g. "F,L0,C,R" or "All"
+    inline unsigned ParseSpectrumCorrections(const std::string &list)
+    {
+      static const std::map<std::string, unsigned> tags = {
+          {"F", CORRECTION_F}, {"L0", CORRECTION_L0}, {"C", CORRECTION_C}, {"U", CORRECTION_U}, {"S", CORRECTION_S}, {"X", CORRECTION_X}, {"R", CORRECTION_R}, {"Rn", CORRECTION_RN}, {"r", CORRECTION_r}, {"Q", CORRECTION_Q}, {"All", CORRECTION_ALL}, {"None", 0u}};
+
+      unsigned corrections = 0;
+      std::string tag;
+      std::istringstream iss(list);
+      while (iss >> tag)
+      {
+        std::istringstream tagStream(tag);
+        std::string sub;
+        while (getline(tagStream, sub, ','))
+        {
+          if (sub.empty())
+            continue;
+          std::map<std::string, unsigned>::const_iterator it = tags.find(sub);
+          if (it == tags.end())
+            Error("Unknown beta spectrum correction \"" + sub + "\". Choose among F, L0, C, U, S, X, R, Rn, r, Q, All or None.");
+          corrections |= it->second;
+        }
+      }
+      return corrections;
+    }
+
+    // Corrections selected in the configuration
+    inline unsigned GetSpectrumCorrections(const BetaDecay &betaDecay)
+    {
+      if (!betaDecay.SpectrumCorrections.empty())
+        return ParseSpectrumCorrections(betaDecay.SpectrumCorrections);
+      return betaDecay.BetaSpectrumCorrections ? (unsigned)CORRECTION_ALL : (unsigned)CORRECTION_F;
+    }
+
+    inline double GetSpectrumHeight(const BetaSpectrumContext &ctx, double Q, double E, bool advanced, int decayType, double mf, double mgt, double mixing_ratio)
     {
       double W = E / EMASSC2 + 1.;
       double W0 = Q / EMASSC2 + 1.;
-      double R = std::sqrt(5. / 3.) * ApproximateRadius(A) / NATURALLENGTH;
       if (advanced)
       {
-        int betaSign = (int)((Z > 0) - (Z < 0)); // signed previously using final and init state
-        Z = std::abs(Z);
-        double cShape, cNS;
         DecayManager &dm = DecayManager::GetInstance();
-        std::tie(cShape, cNS) = CCorrectionComponents(W, W0, Z, A, R, betaSign, decayType, -LAMBDA, -229, 1, 4. * A, 1. * A, 0, 0);
-        double CCorr = cShape + cNS;
-        
-        if (dm.configOptions.betaDecay.BetaSpectrumCorrections)
-          return PhaseSpace(W, W0) * FermiFunction(Z, W, R, betaSign) * AtomicExchangeCorrection(W, Z) * L0Correction(W, Z, R, betaSign) * CCorr * UCorrection(W, Z, betaSign) * AtomicScreeningCorrection(W, Z, betaSign) * RadiativeCorrection(W, W0, Z, R, 1.27, 4.706) * RecoilCorrection(W, W0, A, decayType, mixing_ratio) * AtomicMismatchCorrection(W, W0, Z, A, betaSign) * QCorrection(W, W0, Z, A, betaSign, mf, mgt);
-        else
-          return PhaseSpace(W, W0)*FermiFunction(Z, W, R, betaSign);       
+        SpectrumTransition tr{W0, decayType, mf, mgt, mixing_ratio};
+        double shape;
+        SpectrumShape(GetSpectrumCorrections(dm.configOptions.betaDecay), ctx, tr, &W, &shape, 1);
+        return shape;
       }
       else
       {
-        return PhaseSpace(W, W0) * SimpleFermiFunction(Z, GetSpeed(E, EMASSC2));
+        return PhaseSpace(W, W0) * SimpleFermiFunction(ctx.betaSign * ctx.Z, GetSpeed(E, EMASSC2));
       }
     }
 
-    inline std::vector<std::vector<double>> *GenerateBetaSpectrum(int Z, int A, double Q, bool advancedFermi, int decayType, double mf, double gt, double mixing_ratio)
+    inline BetaSpectrumContext BuildBetaSpectrumContext(int Z, int A)
+    {
+      int betaSign = (int)((Z > 0) - (Z < 0)); // signed previously using final and init state
+      double R = std::sqrt(5. / 3.) * ApproximateRadius(A) / NATURALLENGTH;
+      return BuildBetaSpectrumContext(std::abs(Z), A, R, betaSign);
+    }
+
+    inline double GetSpectrumHeight(int Z, int A, double Q, double E, bool advanced, int decayType, double mf, double mgt, double mixing_ratio)
+    {
+      return GetSpectrumHeight(BuildBetaSpectrumContext(Z, A), Q, E, advanced, decayType, mf, mgt, mixing_ratio);
+    }
+
+    inline std::vector<std::vector<double>> *GenerateBetaSpectrum(int Z, int A, double Q, bool advancedFermi, int decayType, double mf, double gt, double mixing_ratio, double stepSize = 1.0)
     {
       std::vector<std::vector<double>> *dist = new std::vector<std::vector<double>>();
-      double stepSize = 1.0;
 
+      // Z only quantities are computed once for the whole grid
+      BetaSpectrumContext ctx = BuildBetaSpectrumContext(Z, A);
+
+      std::vector<double> energies;
       double currentEnergy = stepSize;
       while (currentEnergy <= Q)
       {
-        double s = GetSpectrumHeight(Z, A, Q, currentEnergy, advancedFermi, decayType, mf, gt, mixing_ratio);
+        energies.push_back(currentEnergy);
+        currentEnergy += stepSize;
+      }
+
+      std::vector<double> shape(energies.size());
+      if (advancedFermi)
+      {
+        // the selected corrections are resolved once for the whole grid
+        DecayManager &dm = DecayManager::GetInstance();
+        SpectrumTransition tr{Q / EMASSC2 + 1., decayType, mf, gt, mixing_ratio};
+        std::vector<double> W(energies.size());
+        for (std::size_t i = 0; i < energies.size(); ++i)
+          W[i] = energies[i] / EMASSC2 + 1.;
+        SpectrumShape(GetSpectrumCorrections(dm.configOptions.betaDecay), ctx, tr, W.data(), shape.data(), W.size());
+      }
+      else
+      {
+        for (std::size_t i = 0; i < energies.size(); ++i)
+          shape[i] = GetSpectrumHeight(ctx, Q, energies[i], false, decayType, mf, gt, mixing_ratio);
+      }
+
+      for (std::size_t i = 0; i < energies.size(); ++i)
+      {
         std::vector<double> pair;
-        pair.push_back(currentEnergy);
-        pair.push_back(s);
+        pair.push_back(energies[i]);
+        pair.push_back(shape[i]);
         dist->push_back(pair);
-        currentEnergy += stepSize;
       }
       return dist;
     }
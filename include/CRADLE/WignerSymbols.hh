@@ -0,0 +1,265 @@
+#ifndef CRADLE_WIGNERSYMBOLS_H
+#define CRADLE_WIGNERSYMBOLS_H
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+
+namespace CRADLE
+{
+  namespace wigner
+  {
+    // All angular momenta are given as integers tj = 2*j (and tm = 2*m),
+    // so that half-integer spins are exact and no floating point checks are needed.
+    // Factorials are handled as logarithms so nothing overflows at high spin;
+    // the alternating Racah sums stay accurate as long as one of the symbol
+    // rows is small (multipoles L, k), which is always the case for gamma cascades.
+
+    //------------------------------------------------------------
+    // ln(n!) table, filled once on first use
+    //------------------------------------------------------------
+    const int LOGFACTORIAL_SIZE = 1024;
+
+    inline const std::array<double, LOGFACTORIAL_SIZE> &LogFactorialTable()
+    {
+      static const std::array<double, LOGFACTORIAL_SIZE> table = []
+      {
+        std::array<double, LOGFACTORIAL_SIZE> t;
+        t[0] = 0.;
+        for (int n = 1; n < LOGFACTORIAL_SIZE; ++n)
+          t[n] = t[n - 1] + std::log((double)n);
+        return t;
+      }();
+      return table;
+    }
+
+    inline double LogFactorial(int n)
+    {
+      if (n < LOGFACTORIAL_SIZE)
+        return LogFactorialTable()[n];
+      return std::lgamma(n + 1.);
+    }
+
+    inline double Phase(int n)
+    {
+      return (n % 2 == 0) ? 1. : -1.;
+    }
+
+    //------------------------------------------------------------
+    // Triangle condition with integer perimeter
+    //------------------------------------------------------------
+    inline bool Triangle(int ta, int tb, int tc)
+    {
+      return tc <= ta + tb && tc >= std::abs(ta - tb) && (ta + tb + tc) % 2 == 0;
+    }
+
+    //------------------------------------------------------------
+    // ln of the Delta coefficient (triangle must hold)
+    //------------------------------------------------------------
+    inline double LogDelta(int ta, int tb, int tc)
+    {
+      return 0.5 * (LogFactorial((ta + tb - tc) / 2) + LogFactorial((ta - tb + tc) / 2) +
+                    LogFactorial((-ta + tb + tc) / 2) - LogFactorial((ta + tb + tc) / 2 + 1));
+    }
+
+    //------------------------------------------------------------
+    // Lock-free memoisation table
+    // Keys are packed in 64 bits (10 bits per argument + symbol tag),
+    // a slot is reserved with a busy bit before its value is published.
+    //------------------------------------------------------------
+    const int CACHE_BITS = 16;
+    const int CACHE_SIZE = 1 << CACHE_BITS;
+    const int CACHE_MAX_PROBE = 32;
+    const uint64_t CACHE_BUSY = uint64_t(1) << 63;
+
+    struct CacheSlot
+    {
+      std::atomic<uint64_t> key{0};
+      std::atomic<double> value{0.};
+    };
+
+    inline CacheSlot *Cache()
+    {
+      static CacheSlot slots[CACHE_SIZE];
+      return slots;
+    }
+
+    inline uint64_t PackKey(int tag, int a, int b, int c, int d, int e, int f)
+    {
+      // arguments are shifted to be positive, tag != 0 so that a key is never 0
+      uint64_t key = (uint64_t)tag;
+      for (int x : {a, b, c, d, e, f})
+        key = (key << 10) | (uint64_t)((x + 512) & 0x3FF);
+      return key;
+    }
+
+    inline bool CacheFind(uint64_t key, double &value)
+    {
+      CacheSlot *slots = Cache();
+      uint64_t h = (key * 0x9E3779B97F4A7C15ULL) >> (64 - CACHE_BITS);
+      for (int i = 0; i < CACHE_MAX_PROBE; ++i)
+      {
+        CacheSlot &slot = slots[(h + i) & (CACHE_SIZE - 1)];
+        uint64_t k = slot.key.load(std::memory_order_acquire);
+        if (k == key)
+        {
+          value = slot.value.load(std::memory_order_relaxed);
+          return true;
+        }
+        if (k == 0)
+          return false;
+      }
+      return false;
+    }
+
+    inline void CacheInsert(uint64_t key, double value)
+    {
+      CacheSlot *slots = Cache();
+      uint64_t h = (key * 0x9E3779B97F4A7C15ULL) >> (64 - CACHE_BITS);
+      for (int i = 0; i < CACHE_MAX_PROBE; ++i)
+      {
+        CacheSlot &slot = slots[(h + i) & (CACHE_SIZE - 1)];
+        uint64_t expected = 0;
+        if (slot.key.compare_exchange_strong(expected, key | CACHE_BUSY, std::memory_order_acq_rel))
+        {
+          slot.value.store(value, std::memory_order_relaxed);
+          slot.key.store(key, std::memory_order_release);
+          return;
+        }
+        if ((expected & ~CACHE_BUSY) == key)
+          return; // already there or being written by another thread
+      }
+      // table region full: value is simply not cached
+    }
+
+    //------------------------------------------------------------
+    // Wigner 3j symbol (Racah formula)
+    // ( j1 j2 j3 )
+    // ( m1 m2 m3 )
+    //------------------------------------------------------------
+    inline double Compute3j(int tj1, int tj2, int tj3, int tm1, int tm2, int tm3)
+    {
+      if (tm1 + tm2 + tm3 != 0)
+        return 0.;
+      if (!Triangle(tj1, tj2, tj3))
+        return 0.;
+      if (std::abs(tm1) > tj1 || std::abs(tm2) > tj2 || std::abs(tm3) > tj3)
+        return 0.;
+      if ((tj1 + tm1) % 2 != 0 || (tj2 + tm2) % 2 != 0 || (tj3 + tm3) % 2 != 0)
+        return 0.;
+
+      double logPref = LogDelta(tj1, tj2, tj3) +
+                       0.5 * (LogFactorial((tj1 + tm1) / 2) + LogFactorial((tj1 - tm1) / 2) +
+                              LogFactorial((tj2 + tm2) / 2) + LogFactorial((tj2 - tm2) / 2) +
+                              LogFactorial((tj3 + tm3) / 2) + LogFactorial((tj3 - tm3) / 2));
+
+      int zmin = std::max({0, (tj2 - tj3 - tm1) / 2, (tj1 - tj3 + tm2) / 2});
+      int zmax = std::min({(tj1 + tj2 - tj3) / 2, (tj1 - tm1) / 2, (tj2 + tm2) / 2});
+
+      double sum = 0.;
+      for (int z = zmin; z <= zmax; ++z)
+      {
+        double logDen = LogFactorial(z) +
+                        LogFactorial((tj1 + tj2 - tj3) / 2 - z) +
+                        LogFactorial((tj1 - tm1) / 2 - z) +
+                        LogFactorial((tj2 + tm2) / 2 - z) +
+                        LogFactorial((tj3 - tj2 + tm1) / 2 + z) +
+                        LogFactorial((tj3 - tj1 - tm2) / 2 + z);
+        sum += Phase(z) * std::exp(logPref - logDen);
+      }
+
+      return Phase((tj1 - tj2 - tm3) / 2) * sum;
+    }
+
+    //------------------------------------------------------------
+    // Wigner 6j symbol (Racah formula)
+    // { j1 j2 j3 }
+    // { l1 l2 l3 }
+    //------------------------------------------------------------
+    inline double Compute6j(int tj1, int tj2, int tj3, int tl1, int tl2, int tl3)
+    {
+      if (!Triangle(tj1, tj2, tj3) || !Triangle(tj1, tl2, tl3) ||
+          !Triangle(tl1, tj2, tl3) || !Triangle(tl1, tl2, tj3))
+        return 0.;
+
+      double logPref = LogDelta(tj1, tj2, tj3) + LogDelta(tj1, tl2, tl3) +
+                       LogDelta(tl1, tj2, tl3) + LogDelta(tl1, tl2, tj3);
+
+      int a1 = (tj1 + tj2 + tj3) / 2;
+      int a2 = (tj1 + tl2 + tl3) / 2;
+      int a3 = (tl1 + tj2 + tl3) / 2;
+      int a4 = (tl1 + tl2 + tj3) / 2;
+      int b1 = (tj1 + tj2 + tl1 + tl2) / 2;
+      int b2 = (tj2 + tj3 + tl2 + tl3) / 2;
+      int b3 = (tj3 + tj1 + tl3 + tl1) / 2;
+
+      int zmin = std::max({a1, a2, a3, a4});
+      int zmax = std::min({b1, b2, b3});
+
+      double sum = 0.;
+      for (int z = zmin; z <= zmax; ++z)
+      {
+        double logDen = LogFactorial(z - a1) + LogFactorial(z - a2) +
+                        LogFactorial(z - a3) + LogFactorial(z - a4) +
+                        LogFactorial(b1 - z) + LogFactorial(b2 - z) + LogFactorial(b3 - z);
+        sum += Phase(z) * std::exp(logPref + LogFactorial(z + 1) - logDen);
+      }
+
+      return sum;
+    }
+
+    //------------------------------------------------------------
+    // Memoised entry points
+    //------------------------------------------------------------
+    inline double Wigner3j(int tj1, int tj2, int tj3, int tm1, int tm2, int tm3)
+    {
+      uint64_t key = PackKey(1, tj1, tj2, tj3, tm1, tm2, tm3);
+      double value;
+      if (CacheFind(key, value))
+        return value;
+      value = Compute3j(tj1, tj2, tj3, tm1, tm2, tm3);
+      CacheInsert(key, value);
+      return value;
+    }
+
+    inline double Wigner6j(int tj1, int tj2, int tj3, int tl1, int tl2, int tl3)
+    {
+      uint64_t key = PackKey(2, tj1, tj2, tj3, tl1, tl2, tl3);
+      double value;
+      if (CacheFind(key, value))
+        return value;
+      value = Compute6j(tj1, tj2, tj3, tl1, tl2, tl3);
+      CacheInsert(key, value);
+      return value;
+    }
+
+    //------------------------------------------------------------
+    // F_k coefficient for one gamma transition I1 -> I2
+    // with multipoles L, Lp (integers) and doubled spins
+    //------------------------------------------------------------
+    inline double GammaFk(int L, int Lp, int tI1, int tI2, int k)
+    {
+      if (k < 0 || k % 2 != 0)
+        return 0.;
+
+      uint64_t key = PackKey(3, L, Lp, tI1, tI2, k, 0);
+      double value;
+      if (CacheFind(key, value))
+        return value;
+
+      double first = Phase((tI1 + tI2) / 2 - 1);
+      double second = std::sqrt((2. * L + 1.) * (2. * Lp + 1.) * (tI2 + 1.) * (2. * k + 1.));
+      double third = Wigner3j(2 * L, 2 * Lp, 2 * k, 2, -2, 0);
+      double fourth = Wigner6j(2 * L, 2 * Lp, 2 * k, tI2, tI2, tI1);
+
+      value = first * second * third * fourth;
+      CacheInsert(key, value);
+      return value;
+    }
+  }
+}
+
+#endif
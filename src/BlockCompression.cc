@@ -0,0 +1,86 @@
+#include "CRADLE/BlockCompression.hh"
+
+#ifdef CRADLE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef CRADLE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace CRADLE {
+
+  namespace compression {
+
+    Format GetFormat(const std::string &name) {
+      auto endsWith = [&](const std::string &suffix) {
+        return name.size() >= suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+      };
+      if (endsWith(".gz"))
+        return Format::Gzip;
+      if (endsWith(".zst"))
+        return Format::Zstd;
+      return Format::None;
+    }
+
+    bool IsAvailable(Format format) {
+      switch (format) {
+        case Format::None:
+          return true;
+        case Format::Gzip:
+#ifdef CRADLE_ZLIB
+          return true;
+#else
+          return false;
+#endif
+        case Format::Zstd:
+#ifdef CRADLE_ZSTD
+          return true;
+#else
+          return false;
+#endif
+      }
+      return false;
+    }
+
+    bool CompressBlock(Format format, std::string &block, int level) {
+      if (format == Format::None)
+        return true;
+      std::string compressed;
+
+      if (format == Format::Gzip) {
+#ifdef CRADLE_ZLIB
+        z_stream stream = {};
+        // 15 + 16: largest window with a gzip header and trailer
+        if (deflateInit2(&stream, level < 0 ? Z_DEFAULT_COMPRESSION : level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+          return false;
+        compressed.resize(deflateBound(&stream, block.size()));
+        stream.next_in = reinterpret_cast<Bytef *>(&block[0]);
+        stream.avail_in = block.size();
+        stream.next_out = reinterpret_cast<Bytef *>(&compressed[0]);
+        stream.avail_out = compressed.size();
+        int status = deflate(&stream, Z_FINISH);
+        compressed.resize(stream.total_out);
+        deflateEnd(&stream);
+        if (status != Z_STREAM_END)
+          return false;
+#else
+        return false;
+#endif
+      }
+      else if (format == Format::Zstd) {
+#ifdef CRADLE_ZSTD
+        compressed.resize(ZSTD_compressBound(block.size()));
+        std::size_t size = ZSTD_compress(&compressed[0], compressed.size(), block.data(), block.size(), level < 0 ? 3 : level);
+        if (ZSTD_isError(size))
+          return false;
+        compressed.resize(size);
+#else
+        return false;
+#endif
+      }
+
+      block.swap(compressed);
+      return true;
+    }
+  }
+}//End of CRADLE namespace
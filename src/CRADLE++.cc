@@ -16,6 +16,12 @@ int main (int argc, const char* argv[]) {
   app.add_option("-o,--output", outputName, "Name for file output. No extensions.");
   app.allow_extras(true);
 
+  double spectrumStep = 1.;
+  CLI::App *spectrumMode = app.add_subcommand("spectrum", "Compute the beta spectra of the nucleus instead of generating events");
+  spectrumMode->add_option("--step", spectrumStep, "Energy step of the spectra in keV.");
+  spectrumMode->allow_extras(true);
+  spectrumMode->fallthrough();
+
   try {
     app.parse(argc, argv);
   } catch (const CLI::ParseError &e) {
@@ -28,7 +34,10 @@ int main (int argc, const char* argv[]) {
   
 
   if (success) {
-    dm.MainLoop();
+    if (*spectrumMode)
+      dm.SpectrumLoop(spectrumStep);
+    else
+      dm.MainLoop();
   } else {
     Error("Specify configuration file, isotope name, charge and number of nucleons. Use the --help option for more documentation.");
   }
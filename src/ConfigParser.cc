@@ -2,6 +2,8 @@
 
 #include "CLI11.hpp"
 
+#include <unistd.h>
+
 namespace CRADLE
 {
 
@@ -28,9 +30,16 @@ namespace CRADLE
     CLI::App *cmd = app.add_subcommand("General", "This is the general subcommand")->ignore_case()->required();
     cmd->add_option("-v,--Verbosity", general.Verbosity, "Verbosity settings");
     cmd->add_option("-f,--Verbosity_file", general.Verbosity_file, "Verbosity File settings");
-    cmd->add_option("-l,--loop", general.Loop, "Number of events to generate.")->required();
+    cmd->add_option("-l,--loop", general.Loop, "Number of events to generate.");
     cmd->add_option("-t,--threads", general.Threads, "Number of threads (2 x #CPU).");
     cmd->add_option("-o,--output", general.Output, "Name of the output file.");
+    cmd->add_option("--Layout", general.Layout, "Layout of the ROOT output (Vector, Flat or RNTuple).");
+    cmd->add_option("--OutputPrecision", general.OutputPrecision, "Precision of the ROOT output (Full or Compact).");
+    cmd->add_option("--Compression", general.Compression, "Compression algorithm of the ROOT output (Default, ZLIB, LZMA, LZ4 or ZSTD).");
+    cmd->add_option("--CompressionLevel", general.CompressionLevel, "Compression level of the ROOT output.");
+    cmd->add_option("--BasketSize", general.BasketSize, "Basket size of the ROOT output branches (bytes).");
+    cmd->add_option("--AutoFlush", general.AutoFlush, "AutoFlush of the ROOT output tree (entries, or bytes if negative).");
+    cmd->add_option("--StreamFormat", general.StreamFormat, "Format of the events streamed to stdout (-o -) or to a FIFO (-o fifo:[path]): TXT or CEV.");
   }
 
   void SetNuclearOptions(CLI::App &app, NuclearOptions &nuclear)
@@ -79,9 +88,29 @@ namespace CRADLE
   void SetCuts(CLI::App &app, Cuts &cuts)
   {
     CLI::App *cmd = app.add_subcommand("Cuts", "This is the cuts subcommand")->ignore_case();
-    cmd->add_option("--distance", cuts.Distance, "")->ignore_case();
-    cmd->add_option("--lifetime", cuts.Lifetime, "")->ignore_case();
-    cmd->add_option("--energy", cuts.Energy, "")->ignore_case();
+    cmd->add_option("--distance", cuts.Distance, "Flight distance (m) above which a particle is not decayed.")->ignore_case();
+    cmd->add_option("--lifetime", cuts.Lifetime, "Time (s) above which a particle is not decayed.")->ignore_case();
+    cmd->add_option("--energy", cuts.Energy, "Kinetic energy (keV) above which a particle is not written.")->ignore_case();
+  }
+
+  void SetFilter(CLI::App &app, Filter &filter)
+  {
+    CLI::App *cmd = app.add_subcommand("Filter", "Events kept only if one of their particles passes the filter")->ignore_case();
+    cmd->add_option("--Particles", filter.Particles, "Selected particles (names, or all).")->ignore_case();
+    cmd->add_option("--EnergyMin", filter.EnergyMin, "Minimum kinetic energy (keV).")->ignore_case();
+    cmd->add_option("--EnergyMax", filter.EnergyMax, "Maximum kinetic energy (keV).")->ignore_case();
+    cmd->add_option("--TimeMin", filter.TimeMin, "Minimum emission time (s).")->ignore_case();
+    cmd->add_option("--TimeMax", filter.TimeMax, "Maximum emission time (s).")->ignore_case();
+    cmd->add_option("--DirectionX", filter.DirectionX, "")->ignore_case();
+    cmd->add_option("--DirectionY", filter.DirectionY, "")->ignore_case();
+    cmd->add_option("--DirectionZ", filter.DirectionZ, "")->ignore_case();
+    cmd->add_option("--ConeAngle", filter.ConeAngle, "Half angle (deg) of the cone around the direction.")->ignore_case();
+  }
+
+  void SetHistograms(CLI::App &app, Histograms &histograms)
+  {
+    CLI::App *cmd = app.add_subcommand("Histograms", "Histograms filled instead of writing the events")->ignore_case();
+    cmd->add_option("--Histogram", histograms.Histogram, "Histogram as variable:particle:bins:min:max[:cut].");
   }
 
   void SetBetaDecayOptions(CLI::App &app, BetaDecay &betaDecay)
@@ -90,6 +119,7 @@ namespace CRADLE
     cmd->add_option("--Default", betaDecay.Default, "");
     cmd->add_option("--FermiFunction", betaDecay.FermiFunction, "");
     cmd->add_option("--BetaSpectrumCorrections", betaDecay.BetaSpectrumCorrections, "")->ignore_case();
+    cmd->add_option("--SpectrumCorrections", betaDecay.SpectrumCorrections, "Corrections of the beta spectrum shape among F, L0, C, U, S, X, R, Rn, r, Q")->ignore_case();
     cmd->add_option("--RadiativeCorrections", betaDecay.RadiativeCorrections, "")->ignore_case();
     cmd->add_option("--Cs", betaDecay.Cs, "")->ignore_case();
   }
@@ -100,6 +130,8 @@ namespace CRADLE
     cmd->add_option("--NuclearLevelWidth", decay.NuclearLevelWidth, "")->ignore_case();
     cmd->add_option("--InFlightDecay", decay.InFlightDecay, "")->ignore_case();
     cmd->add_option("--GammaGammaCorrelation", decay.GammaGammaCorrelation, "")->ignore_case();
+    cmd->add_option("--Bias", decay.Bias, "Channels sampled more often, as [mode:][nucleus:level:]factor.")->ignore_case();
+    cmd->add_option("--ForcePath", decay.ForcePath, "Only decay path generated, as steps mode:nucleus:level.")->ignore_case();
   }
 
   void SetEnvironmentOptions(CLI::App &app, EnvOptions &envOptions)
@@ -126,9 +158,20 @@ namespace CRADLE
     SetBetaDecayOptions(app, configOptions.betaDecay);
     SetDecayOptions(app, configOptions.decay);
     SetEnvironmentOptions(app, configOptions.envOptions);
+    SetHistograms(app, configOptions.histograms);
+    SetFilter(app, configOptions.filter);
 
     parse(app, argc, argv);
 
+    // Events streamed to stdout: the original stdout is kept for the events and
+    // every message from now on goes to stderr
+    if (configOptions.general.Output == "-")
+    {
+      std::cout.flush();
+      configOptions.general.OutputDescriptor = dup(STDOUT_FILENO);
+      dup2(STDERR_FILENO, STDOUT_FILENO);
+    }
+
     // setup complex output file Cx from iCx
     configOptions.couplingConstants.CS = std::complex<double>(configOptions.couplingConstants.CS.real(), configOptions.couplingConstants.iCS);
     configOptions.couplingConstants.CV = std::complex<double>(configOptions.couplingConstants.CV.real(), configOptions.couplingConstants.iCV);
@@ -155,6 +198,12 @@ namespace CRADLE
     Message("General", "Loop: " + std::to_string(configOptions.general.Loop), 1, "blue");
     Message("General", "Threads: " + std::to_string(configOptions.general.Threads), 1, "blue");
     Message("General", "Output: " + configOptions.general.Output, 1, "blue");
+    Message("General", "Layout: " + configOptions.general.Layout, 1, "blue");
+    Message("General", "OutputPrecision: " + configOptions.general.OutputPrecision, 1, "blue");
+    Message("General", "Compression: " + configOptions.general.Compression + " (" + std::to_string(configOptions.general.CompressionLevel) + ")", 1, "blue");
+    Message("General", "BasketSize: " + std::to_string(configOptions.general.BasketSize), 1, "blue");
+    Message("General", "AutoFlush: " + std::to_string(configOptions.general.AutoFlush), 1, "blue");
+    Message("General", "StreamFormat: " + configOptions.general.StreamFormat, 1, "blue");
 
     Message("Nucleus", "", 0, "CYAN");
     Message("Nucleus", "Name: " + configOptions.nuclear.Name, 1, "blue");
@@ -185,15 +234,36 @@ namespace CRADLE
     Message("Correlation", Form("D: %.2f", configOptions.couplingConstants.D), 1, "blue");
     Message("Correlation", Form("c: %.2f", configOptions.couplingConstants.c), 1, "blue");
 
+    if (!configOptions.histograms.Histogram.empty())
+    {
+      Message("Histograms", "", 0, "CYAN");
+      for (const std::string &histogram : configOptions.histograms.Histogram)
+        Message("Histograms", histogram, 1, "blue");
+    }
+
     Message("Cuts", "", 0, "CYAN");
     Message("Cuts", Form("Distance: %.2f", configOptions.cuts.Distance), 1, "blue");
     Message("Cuts", Form("Lifetime: %.2f", configOptions.cuts.Lifetime), 1, "blue");
     Message("Cuts", Form("Energy: %.2f", configOptions.cuts.Energy), 1, "blue");
 
+    if (!configOptions.filter.Particles.empty())
+    {
+      std::string particles;
+      for (const std::string &particle : configOptions.filter.Particles)
+        particles += (particles.empty() ? "" : ", ") + particle;
+      Message("Filter", "", 0, "CYAN");
+      Message("Filter", "Particles: " + particles, 1, "blue");
+      Message("Filter", Form("Energy: [%.2f, %.2f] keV", configOptions.filter.EnergyMin, configOptions.filter.EnergyMax), 1, "blue");
+      Message("Filter", Form("Time: [%.3g, %.3g] s", configOptions.filter.TimeMin, configOptions.filter.TimeMax), 1, "blue");
+      Message("Filter", Form("Cone: %.1f deg around (%.2f, %.2f, %.2f)", configOptions.filter.ConeAngle, configOptions.filter.DirectionX, configOptions.filter.DirectionY, configOptions.filter.DirectionZ), 1, "blue");
+    }
+
     Message("BetaDecay", "", 0, "CYAN");
     Message("BetaDecay", "Default: " + configOptions.betaDecay.Default, 1, "blue");
     Message("BetaDecay", "FermiFunction: " + configOptions.betaDecay.FermiFunction, 1, "blue");
     Message("BetaDecay", Form("BetaSpectrumCorrections: %s", configOptions.betaDecay.BetaSpectrumCorrections ? "true" : "false"), 1, "blue");
+    if (!configOptions.betaDecay.SpectrumCorrections.empty())
+      Message("BetaDecay", "SpectrumCorrections: " + configOptions.betaDecay.SpectrumCorrections, 1, "blue");
     Message("BetaDecay", Form("RadiativeCorrections: %s", configOptions.betaDecay.RadiativeCorrections ? "true" : "false"), 1, "blue");
     Message("BetaDecay", Form("Cs: %.5f", configOptions.betaDecay.Cs), 1, "blue");
 
@@ -201,5 +271,14 @@ namespace CRADLE
     Message("Decay", Form("InFlightDecay: %s", configOptions.decay.InFlightDecay ? "true" : "false"), 1, "blue");
     Message("Decay", Form("NuclearLevelWidth: %s", configOptions.decay.NuclearLevelWidth ? "true" : "false"), 1, "blue");
     Message("Decay", Form("γγ Correlation: %s", configOptions.decay.GammaGammaCorrelation ? "true" : "false"), 1, "blue");
+    for (const std::string &bias : configOptions.decay.Bias)
+      Message("Decay", "Bias: " + bias, 1, "blue");
+    if (!configOptions.decay.ForcePath.empty())
+    {
+      std::string path;
+      for (const std::string &step : configOptions.decay.ForcePath)
+        path += (path.empty() ? "" : " -> ") + step;
+      Message("Decay", "ForcePath: " + path, 1, "blue");
+    }
   }
 } // end of namespace CRADLE
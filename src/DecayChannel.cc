@@ -2,6 +2,7 @@
 #include "CRADLE/DecayMode.hh"
 #include "CRADLE/DecayManager.hh"
 #include "CRADLE/Particle.hh"
+#include "CRADLE/Utilities.hh"
 
 #include <iostream>
 #include <stdexcept>
@@ -9,7 +10,7 @@
 namespace CRADLE {
 
   DecayChannel::DecayChannel(std::string md, DecayMode* dm, double q, double i, double t, double pExEn, double dExEn):
-    modeName(md), decayMode(dm), Q(q), intensity(i), lifetime(t), parentExcitationEnergy(pExEn), daughterExcitationEnergy(dExEn){
+    modeName(md), decayMode(dm), Q(q), intensity(i), lifetime(t), levelWidth(utilities::BreitWignerHalfWidth(t)), parentExcitationEnergy(pExEn), daughterExcitationEnergy(dExEn){
   }
 
   // DecayChannel::DecayChannel(std::string md, DecayMode* dm, double q, double i, double t, double pExEn, double dExEn, double ph):
@@ -17,7 +18,7 @@ namespace CRADLE {
   // }
 
   DecayChannel::DecayChannel(std::string md, DecayMode* dm, double q, double i, double t, double pExEn, double dExEn, std::pair<int, int> multipolarities, double mixingratio):
-    modeName(md), decayMode(dm), Q(q), intensity(i), lifetime(t), parentExcitationEnergy(pExEn), daughterExcitationEnergy(dExEn), Multipolarities(multipolarities), mixingRatio(mixingratio){
+    modeName(md), decayMode(dm), Q(q), intensity(i), lifetime(t), levelWidth(utilities::BreitWignerHalfWidth(t)), parentExcitationEnergy(pExEn), daughterExcitationEnergy(dExEn), Multipolarities(multipolarities), mixingRatio(mixingratio){
   }
 
   std::vector<Particle*> DecayChannel::Decay (Particle* initState) {
@@ -7,10 +7,24 @@
 #include "CRADLE/ThreadPool.hh"
 #include "CRADLE/ECShell.hh"
 #include "CRADLE/RadiativeCorrections.hh"
+#include "CRADLE/EventFile.hh"
+#include "CRADLE/BlockCompression.hh"
 
 #include <ROOT/TBufferMerger.hxx>
 #include <ROOT/TThreadExecutor.hxx>
 #include <ROOT/RDataFrame.hxx>
+#include "TH1D.h"
+#include "TParameter.h"
+#include <RVersion.h>
+#include <Compression.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6, 36, 0)
+#define CRADLE_RNTUPLE
+#include <ROOT/RField.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleWriteOptions.hxx>
+#include <ROOT/RNTupleFillContext.hxx>
+#include <ROOT/RNTupleParallelWriter.hxx>
+#endif
 
 // #include <boost/progress.hpp>
 #include <fstream>
@@ -18,9 +32,19 @@
 #include <stdexcept>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <cerrno>
 #include <future>
 
 #include <iomanip>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <condition_variable>
+#include <iterator>
+#include <spdlog/fmt/fmt.h>
 
 template <typename A, typename B>
 std::pair<B, A> flip_pair(const std::pair<A, B> &p)
@@ -242,6 +266,21 @@ namespace CRADLE
     return registeredChannelProperties.at(name).mgt;
   }
 
+  void DecayManager::RegisterGammaCascadeTable(const int pdg, const GammaCascadeTable &table)
+  {
+    registeredGammaCascadeTables[pdg] = table;
+    if (configOptions.general.Verbosity >= 2)
+      Info(Form("Registered %d gamma-gamma cascades for PDG code %d", (int)table.GetNumberOfCascades(), pdg));
+  }
+
+  const GammaCascadeTable *DecayManager::GetGammaCascadeTable(const int pdg) const
+  {
+    std::map<const int, GammaCascadeTable>::const_iterator it = registeredGammaCascadeTables.find(pdg);
+    if (it == registeredGammaCascadeTables.end())
+      return nullptr;
+    return &(it->second);
+  }
+
   void DecayManager::RegisterBasicParticles()
   {
     RegisterParticle(new Particle(NametoPDG("e-"), utilities::EMASSC2, -1, 0, 0.5, 0.));
@@ -365,6 +404,12 @@ namespace CRADLE
     outputFile->cd("Configuration");
     filename = filename.substr(filename.find_last_of("/\\") + 1);
     stringObject_data->Write(filename.c_str(), TObject::kOverwrite);
+    // Natural branching ratio of the forced path, to recover absolute rates
+    if (decayPlan.IsForced())
+    {
+      TParameter<double> branchingRatio("BranchingRatio", decayPlan.GetBranchingRatio());
+      branchingRatio.Write("BranchingRatio", TObject::kOverwrite);
+    }
     outputFile->cd();
   }
 
@@ -496,6 +541,7 @@ namespace CRADLE
     gammaFileSS << configOptions.envOptions.Gammadata;
     gammaFileSS << "/z" << Z << ".a" << A;
     std::ifstream gammaDataFile(gammaFileSS.str().c_str());
+    GammaCascadeTable cascadeTable;
     if (gammaDataFile.is_open())
     {
       while (getline(gammaDataFile, line))
@@ -514,6 +560,7 @@ namespace CRADLE
 
         std::istringstream iss(line);
         iss >> levelNr >> flag >> initEnergy >> lifetime >> angMom >> nGammas;
+        cascadeTable.AddLevel(initEnergy, std::atof(angMom.c_str()));
 
         double other_process_intensity = p->GetTotalIntensity(initEnergy);
         double feeding_intensity = 0.;
@@ -567,6 +614,7 @@ namespace CRADLE
                 new DecayChannel("Gamma", &GetDecayMode("Gamma"), E, intensity / (1. + convIntensity),
                                  lifetime, initEnergy, initEnergy - E, possibleMultipolarities, multipolarityMixing);
             p->AddDecayChannel(dcGamma);
+            cascadeTable.AddTransition(initEnergy, initEnergy - E, possibleMultipolarities, multipolarityMixing);
 
             if (convIntensity == 0)
               continue;
@@ -627,6 +675,13 @@ namespace CRADLE
     }
     RegisterParticle(p);
 
+    // All gamma-gamma cascades of the level scheme are computed here, once
+    if (configOptions.decay.GammaGammaCorrelation)
+    {
+      cascadeTable.Build();
+      RegisterGammaCascadeTable(p->GetPDG(), cascadeTable);
+    }
+
     if (configOptions.general.Verbosity >= 2)
       Info("Nucleus " + name + " generated with " + std::to_string(p->GetDecayChannels().size()) + " decay channels.");
     return true;
@@ -649,6 +704,12 @@ namespace CRADLE
     outputName = configOptions.general.Output;
     NRTHREADS = configOptions.general.Threads;
 
+    // Older configs set these cuts to 1 while they had no effect
+    if (configOptions.cuts.Distance < 1.E10)
+      Warning(Form("Cuts.Distance = %g m: particles flying farther before decaying are not decayed", configOptions.cuts.Distance));
+    if (configOptions.cuts.Energy < 1.E10)
+      Warning(Form("Cuts.Energy = %g keV: particles of higher kinetic energy are not written", configOptions.cuts.Energy));
+
     if (initStateName != "" && configOptions.nuclear.Nucleons > 0)
     {
       struct stat infoRD;
@@ -680,16 +741,359 @@ namespace CRADLE
     }
   }
 
-  std::vector<ParticleData> DecayManager::GenerateEvent_ROOT(int eventNr, int verbosity)
+  void DecayManager::CompileDecayPlan()
+  {
+    // Levels of a nucleus at a given excitation energy and the daughter they decay to
+    auto addNode = [this](int pdg, double excitationEnergy)
+    {
+      vector<DecayChannel *> channels;
+      for (DecayChannel *dc : registeredParticles.at(pdg)->GetDecayChannels())
+      {
+        if (std::abs(dc->GetParentExcitationEnergy() - excitationEnergy) < 2.)
+          channels.push_back(dc);
+      }
+      return decayPlan.AddNode(pdg, excitationEnergy, channels);
+    };
+
+    decayPlan.Clear();
+    vector<int> toCompile = {addNode(initStatePDG, initExcitationEn)};
+    while (!toCompile.empty())
+    {
+      int node = toCompile.back();
+      toCompile.pop_back();
+      int pdg = decayPlan.GetNode(node).pdg;
+      int Z = registeredParticles.at(pdg)->GetCharge();
+      int A = registeredParticles.at(pdg)->GetNucleons();
+      vector<DecayChannel *> channels = decayPlan.GetNode(node).channels;
+
+      for (size_t c = 0; c < channels.size(); ++c)
+      {
+        string mode = channels[c]->GetModeName();
+        int daughterZ = Z;
+        int daughterA = A;
+        if (mode.find("Beta") != string::npos)
+          daughterZ += (channels[c]->GetQValue() < 0) ? -1 : 1;
+        else if (mode.find("EC") != string::npos)
+          daughterZ -= 1;
+        else if (mode == "Proton")
+        {
+          daughterZ -= 1;
+          daughterA -= 1;
+        }
+        else if (mode == "Alpha")
+        {
+          daughterZ -= 2;
+          daughterA -= 4;
+        }
+        else if (mode != "Gamma" && mode != "IT" && mode != "ConversionElectron")
+          continue;
+
+        // Daughters are generated here rather than lazily from the event threads
+        int daughterPDG = GetPDG(daughterZ, daughterA);
+        if (registeredParticles.count(daughterPDG) == 0)
+          GenerateNucleus(PDGtoName(daughterPDG), daughterZ, daughterA);
+
+        double daughterExcitationEnergy = channels[c]->GetDaughterExcitationEnergy();
+        int child = decayPlan.FindNode(daughterPDG, daughterExcitationEnergy);
+        if (child < 0)
+        {
+          child = addNode(daughterPDG, daughterExcitationEnergy);
+          toCompile.push_back(child);
+        }
+        decayPlan.SetChild(node, c, child);
+      }
+    }
+
+    Info("Compiled decay plan with " + std::to_string(decayPlan.GetNumberOfNodes()) + " levels");
+    ForceDecayPath();
+    BiasDecayPlan();
+    CompileEventFilter();
+  }
+
+  void DecayManager::ForceDecayPath()
+  {
+    if (configOptions.decay.ForcePath.empty())
+      return;
+
+    // Every step keeps the channels of the current level with the given mode feeding the
+    // given daughter level, the next step starts from that level
+    int node = decayPlan.FindNode(initStatePDG, initExcitationEn);
+    for (const std::string &step : configOptions.decay.ForcePath)
+    {
+      std::vector<std::string> fields;
+      std::stringstream stream(step);
+      std::string field;
+      while (std::getline(stream, field, ':'))
+        fields.push_back(field);
+      if (fields.size() != 3)
+        Error("Step " + step + " of the forced path is not mode:nucleus:level");
+
+      const int pdg = NametoPDG(fields[1]);
+      double excitationEnergy = 0.;
+      try
+      {
+        excitationEnergy = std::stod(fields[2]);
+      }
+      catch (const std::exception &e)
+      {
+        Error("Incorrect level in step " + step + " of the forced path");
+      }
+
+      const DecayPlanNode &n = decayPlan.GetNode(node);
+      std::vector<char> allowed(n.channels.size(), 0);
+      int child = -1;
+      for (std::size_t c = 0; c < n.channels.size(); ++c)
+      {
+        if (n.channels[c]->GetModeName() != fields[0] || n.children[c] < 0 ||
+            !decayPlan.IsSameLevel(n.children[c], pdg, excitationEnergy))
+          continue;
+        allowed[c] = 1;
+        child = n.children[c];
+      }
+      const double branchingRatio = (child < 0) ? 0. : decayPlan.ForceChannels(node, allowed);
+      if (branchingRatio <= 0.)
+        Error(Form("No channel of %s (%.1f keV) matches step %s of the forced path", PDGtoName(n.pdg).c_str(), n.excitationEnergy, step.c_str()));
+      Info(Form("Forced path step %s: branching ratio %g", step.c_str(), branchingRatio));
+      node = child;
+    }
+    Info(Form("Branching ratio of the forced path: %g", decayPlan.GetBranchingRatio()));
+  }
+
+  void DecayManager::BiasDecayPlan()
+  {
+    struct Bias
+    {
+      std::string mode; // empty: every mode
+      int pdg = 0; // daughter level, 0: every level
+      double excitationEnergy = 0.;
+      double factor = 1.;
+    };
+
+    std::vector<Bias> biases;
+    for (const std::string &definition : configOptions.decay.Bias)
+    {
+      std::vector<std::string> fields;
+      std::stringstream stream(definition);
+      std::string field;
+      while (std::getline(stream, field, ':'))
+        fields.push_back(field);
+      if (fields.size() < 2 || fields.size() > 4)
+        Error("Bias " + definition + " is not [mode:][nucleus:level:]factor");
+
+      Bias bias;
+      try
+      {
+        bias.factor = std::stod(fields.back());
+        if (fields.size() != 3)
+          bias.mode = fields[0];
+        if (fields.size() > 2)
+        {
+          bias.pdg = NametoPDG(fields[fields.size() - 3]);
+          bias.excitationEnergy = std::stod(fields[fields.size() - 2]);
+        }
+      }
+      catch (const std::exception &e)
+      {
+        Error("Incorrect number in bias " + definition);
+      }
+      if (bias.factor <= 0.)
+        Error("The factor of bias " + definition + " must be positive");
+      if (fields.size() > 2 && bias.pdg == 0)
+        Error("Unknown nucleus in bias " + definition);
+      biases.push_back(bias);
+    }
+    if (biases.empty())
+      return;
+
+    // The factors of every bias matching a channel (mode and daughter level) are multiplied
+    int nBiased = 0;
+    for (std::size_t node = 0; node < decayPlan.GetNumberOfNodes(); ++node)
+    {
+      const DecayPlanNode &n = decayPlan.GetNode(node);
+      std::vector<double> factors(n.channels.size(), 1.);
+      bool biased = false;
+      for (std::size_t c = 0; c < n.channels.size(); ++c)
+      {
+        for (const Bias &bias : biases)
+        {
+          if (!bias.mode.empty() && n.channels[c]->GetModeName() != bias.mode)
+            continue;
+          if (bias.pdg != 0 && (n.children[c] < 0 || !decayPlan.IsSameLevel(n.children[c], bias.pdg, bias.excitationEnergy)))
+            continue;
+          factors[c] *= bias.factor;
+        }
+        if (factors[c] != 1.)
+        {
+          biased = true;
+          ++nBiased;
+        }
+      }
+      if (biased)
+        decayPlan.SetBias(node, factors);
+    }
+
+    if (nBiased == 0)
+      Warning("No decay channel matches the biases");
+    else
+      Info("Biased " + std::to_string(nBiased) + " decay channels, the events are weighted");
+  }
+
+  void DecayManager::CompileEventFilter()
+  {
+    const Filter &filter = configOptions.filter;
+    eventFilter = EventFilter();
+    if (filter.Particles.empty())
+      return;
+
+    eventFilter.enabled = true;
+    for (const std::string &name : filter.Particles)
+    {
+      if (name == "all")
+      {
+        eventFilter.codes.clear();
+        break;
+      }
+      auto it = NametoCode_map.find(name);
+      if (it == NametoCode_map.end())
+        Error("Unknown particle " + name + " in the filter");
+      eventFilter.codes.push_back(it->second);
+    }
+    eventFilter.energyMin = filter.EnergyMin;
+    eventFilter.energyMax = filter.EnergyMax;
+    eventFilter.timeMin = filter.TimeMin;
+    eventFilter.timeMax = filter.TimeMax;
+    const double norm = sqrt(pow(filter.DirectionX, 2) + pow(filter.DirectionY, 2) + pow(filter.DirectionZ, 2));
+    if (norm == 0.)
+      Error("The direction of the filter is null");
+    eventFilter.direction[0] = filter.DirectionX / norm;
+    eventFilter.direction[1] = filter.DirectionY / norm;
+    eventFilter.direction[2] = filter.DirectionZ / norm;
+    eventFilter.cosCone = (filter.ConeAngle >= 180.) ? -1. : cos(filter.ConeAngle * utilities::PI / 180.);
+
+    // Light particles each decay mode may emit, on top of the daughter nucleus; the lists are
+    // broad on purpose since they only serve to stop the events that cannot pass any more
+    static const std::map<std::string, std::vector<int>> emitted = {
+        {"Beta", {11, -11, 12, -12, 22}},
+        {"Beta_RC", {11, -11, 12, -12, 22}},
+        {"EC", {11, 12, 22}},
+        {"Proton", {2212}},
+        {"Alpha", {1000020040}},
+        {"Gamma", {11, 22}},
+        {"IT", {11, 22}},
+        {"ConversionElectron", {11, 22}}};
+
+    // A level can lead to a selected particle if one of its channels emits one or if its
+    // daughter level can; iterated up to the fixed point, so that the plan may hold loops
+    const std::size_t nNodes = decayPlan.GetNumberOfNodes();
+    eventFilter.reachable.assign(nNodes, 0);
+    bool changed = true;
+    while (changed)
+    {
+      changed = false;
+      for (std::size_t node = 0; node < nNodes; ++node)
+      {
+        if (eventFilter.reachable[node])
+          continue;
+        const DecayPlanNode &n = decayPlan.GetNode(node);
+        for (std::size_t c = 0; c < n.channels.size() && !eventFilter.reachable[node]; ++c)
+        {
+          const int child = n.children[c];
+          auto it = emitted.find(n.channels[c]->GetModeName());
+          bool reachable = (child < 0 || it == emitted.end());
+          if (!reachable)
+          {
+            for (int code : it->second)
+              reachable = reachable || eventFilter.Selects(code);
+            reachable = reachable || eventFilter.Selects(decayPlan.GetNode(child).pdg) || eventFilter.reachable[child];
+          }
+          if (reachable)
+          {
+            eventFilter.reachable[node] = 1;
+            changed = true;
+          }
+        }
+      }
+    }
+
+    const int root = decayPlan.FindNode(initStatePDG, initExcitationEn);
+    if (!eventFilter.Selects(initStatePDG) && (root < 0 || !eventFilter.reachable[root]))
+      Error("None of the particles of the filter can be emitted by " + initStateName);
+  }
+
+  bool DecayManager::CanPassFilter(const std::vector<Particle *> &particles, double time) const
+  {
+    // Times only grow along an event
+    if (time > eventFilter.timeMax)
+      return false;
+    for (Particle *p : particles)
+    {
+      if (eventFilter.Selects(p->GetPDG()))
+        return true;
+      const int node = p->GetPlanNode();
+      if (node >= 0 ? eventFilter.reachable[node] != 0 : !p->GetDecayChannels().empty())
+        return true;
+    }
+    return false;
+  }
+
+  double DecayManager::GetDecayTime(Particle *p)
+  {
+    int node = p->GetPlanNode();
+    if (node < 0)
+      return p->GetDecayTime();
+    return p->GetDecayTime(decayPlan.GetNode(node).lifetime);
+  }
+
+  bool DecayManager::IsDecayedWithinCuts(Particle *p, double time, double decayTime)
+  {
+    return (time + decayTime) <= configOptions.cuts.Lifetime && IsFlightWithinCut(p, decayTime);
+  }
+
+  bool DecayManager::IsFlightWithinCut(Particle *p, double decayTime)
+  {
+    // Distance flown before the decay, beta c t with beta = |p| / E
+    const ublas::vector<double> &momentum = p->GetMomentum();
+    const double beta = sqrt(pow(momentum[1], 2) + pow(momentum[2], 2) + pow(momentum[3], 2)) / momentum[0];
+    return beta * utilities::C * decayTime <= configOptions.cuts.Distance;
+  }
+
+  std::vector<Particle *> DecayManager::DecayParticle(Particle *p, double &weight)
+  {
+    int node = p->GetPlanNode();
+    if (node < 0)
+      return p->Decay();
+
+    const DecayPlanNode &n = decayPlan.GetNode(node);
+    if (n.channels.empty())
+      return std::vector<Particle *>();
+
+    // Per-thread engine, rand() would serialise the worker threads on its lock
+    thread_local std::mt19937_64 channelGenerator(rand());
+    std::uniform_real_distribution<double> uniform(0., 1.);
+    int c = decayPlan.SampleChannel(node, uniform(channelGenerator));
+    weight *= n.weights[c];
+    std::vector<Particle *> finalStates = n.channels[c]->Decay(p);
+
+    // The recoiling nucleus comes first in the final states of every decay mode
+    int child = n.children[c];
+    if (child >= 0 && !finalStates.empty() && finalStates[0]->GetPDG() == decayPlan.GetNode(child).pdg)
+      finalStates[0]->SetPlanNode(child);
+    return finalStates;
+  }
+
+  std::size_t DecayManager::GenerateEvent(int eventNr, int verbosity, ParticleBuffer &buffer)
   {
     double time = 0.;
     double checkTime = 0.;
 
-    std::vector<ParticleData> vec;
+    const std::size_t first = buffer.Size();
+    bool accepted = !eventFilter.enabled;
+    double weight = 1.;
 
     std::vector<Particle *> particleStack;
     Particle *ini = GetNewParticle(initStatePDG);
     ini->SetExcitationEnergy(initExcitationEn);
+    ini->SetPlanNode(decayPlan.FindNode(initStatePDG, initExcitationEn));
 
     // SET INITIAL KIONETIC ENERGY TO 10keV and the momentum only on the z axis
     // ini->SetKinEnergy(10);
@@ -705,11 +1109,10 @@ namespace CRADLE
     while (!particleStack.empty())
     {
       double mom;
-      ParticleData ParticleData_ini;
 
       Particle *p = particleStack.back();
       vector<Particle *> finalStates;
-      double decayTime = p->GetDecayTime();
+      double decayTime = GetDecayTime(p);
       bool filling = true;
       // cout << "\n Decaying particle " << p->GetName() << endl;
       // std::cout << eventNr << "\t" << subEventNr << std::endl;
@@ -718,32 +1121,37 @@ namespace CRADLE
       //           << "decayTime =\t" << decayTime << std::endl;
       if (verbosity == 0)
       {
-        if (find(RestrictedParticleList.begin(), RestrictedParticleList.end(), p->GetPDG()) == RestrictedParticleList.end())
+        if (!IsRestrictedParticle(p->GetPDG()))
         {
           filling = false;
         }
       }
+      if (p->GetKinEnergy() > configOptions.cuts.Energy)
+        filling = false;
 
       if (filling)
       {
-        ParticleData_ini.code = p->GetPDG();
-        ParticleData_ini.time = time;
-        ParticleData_ini.excitation_energy = p->GetExcitationEnergy();
-        ParticleData_ini.kinetic_energy = p->GetKinEnergy();
-        mom = sqrt(pow(p->GetMomentum()[1], 2) + pow(p->GetMomentum()[2], 2) + pow(p->GetMomentum()[3], 2));
-        ParticleData_ini.p = p->GetMomentum()[0];
-        ParticleData_ini.px = p->GetMomentum()[1] / mom;
-        ParticleData_ini.py = p->GetMomentum()[2] / mom;
-        ParticleData_ini.pz = p->GetMomentum()[3] / mom;
-        vec.push_back(ParticleData_ini);
+        const ublas::vector<double> &momentum = p->GetMomentum();
+        mom = sqrt(pow(momentum[1], 2) + pow(momentum[2], 2) + pow(momentum[3], 2));
+        buffer.event.push_back(eventNr);
+        buffer.code.push_back(p->GetPDG());
+        buffer.time.push_back(time);
+        buffer.excitation_energy.push_back(p->GetExcitationEnergy());
+        buffer.kinetic_energy.push_back(p->GetKinEnergy());
+        buffer.p.push_back(momentum[0]);
+        buffer.px.push_back(momentum[1] / mom);
+        buffer.py.push_back(momentum[2] / mom);
+        buffer.pz.push_back(momentum[3] / mom);
+        if (!accepted)
+          accepted = eventFilter.Accept(p->GetPDG(), time, buffer.kinetic_energy.back(), buffer.px.back(), buffer.py.back(), buffer.pz.back());
       }
 
-      if ((time + decayTime) <= configOptions.cuts.Lifetime)
+      if (IsDecayedWithinCuts(p, time, decayTime))
       {
         try
         {
           time += decayTime;
-          finalStates = p->Decay();
+          finalStates = DecayParticle(p, weight);
         }
         catch (const std::invalid_argument &e)
         {
@@ -757,23 +1165,146 @@ namespace CRADLE
         particleStack.insert(particleStack.end(), finalStates.begin(),
                              finalStates.end());
       }
+
+      // Nothing left in the event can pass the filter: the rest of the chain is not generated
+      if (!accepted && !CanPassFilter(particleStack, time))
+      {
+        for (Particle *q : particleStack)
+          delete q;
+        particleStack.clear();
+      }
+    }
+    if (!accepted)
+    {
+      buffer.Truncate(first);
+      return 0;
+    }
+    // The multiplicity and the weight are only known once the whole event has been generated
+    const std::size_t n = buffer.Size() - first;
+    buffer.multiplicity.resize(buffer.Size(), n);
+    buffer.weight.resize(buffer.Size(), weight);
+    return n;
+  }
+
+  unsigned short ParticleCodeTable::GetIndex(int code)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = indices.find(code);
+    if (it != indices.end())
+      return it->second;
+    unsigned short index = codes.size();
+    codes.push_back(code);
+    indices.emplace(code, index);
+    return index;
+  }
+
+  std::vector<int> ParticleCodeTable::GetCodes()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return codes;
+  }
+
+  void ParticleCodeTable::Clear()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    indices.clear();
+    codes.clear();
+  }
+
+  // Keeps 12 bits of mantissa, as a Float16_t without range; the zeroed low bits compress away
+  static inline float TruncateMantissa(double value)
+  {
+    float x = value;
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    bits &= ~uint32_t(0x7FF);
+    std::memcpy(&x, &bits, sizeof(bits));
+    return x;
+  }
+
+  void CompactParticleBuffer::Assign(const ParticleBuffer &buffer, ParticleCodeTable &table)
+  {
+    const std::size_t n = buffer.Size();
+    code.resize(n);
+    time.assign(buffer.time.begin(), buffer.time.end());
+    excitation_energy.assign(buffer.excitation_energy.begin(), buffer.excitation_energy.end());
+    kinetic_energy.assign(buffer.kinetic_energy.begin(), buffer.kinetic_energy.end());
+    p.assign(buffer.p.begin(), buffer.p.end());
+    px.resize(n);
+    py.resize(n);
+    pz.resize(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      px[i] = TruncateMantissa(buffer.px[i]);
+      py[i] = TruncateMantissa(buffer.py[i]);
+      pz[i] = TruncateMantissa(buffer.pz[i]);
+      auto it = codeCache.find(buffer.code[i]);
+      if (it == codeCache.end())
+        it = codeCache.emplace(buffer.code[i], table.GetIndex(buffer.code[i])).first;
+      code[i] = it->second;
+    }
+  }
+
+  std::vector<ParticleData> DecayManager::GenerateEvent_ROOT(int eventNr, int verbosity)
+  {
+    ParticleBuffer buffer;
+    GenerateEvent(eventNr, verbosity, buffer);
+
+    std::vector<ParticleData> vec(buffer.Size());
+    for (std::size_t i = 0; i < vec.size(); ++i)
+    {
+      vec[i].code = buffer.code[i];
+      vec[i].time = buffer.time[i];
+      vec[i].excitation_energy = buffer.excitation_energy[i];
+      vec[i].kinetic_energy = buffer.kinetic_energy[i];
+      vec[i].p = buffer.p[i];
+      vec[i].px = buffer.px[i];
+      vec[i].py = buffer.py[i];
+      vec[i].pz = buffer.pz[i];
     }
     return vec;
   }
 
   std::string DecayManager::GenerateEvent_TXT(int eventNr, int verbosity)
+  {
+    std::string eventData;
+    GenerateEvent_TXT(eventNr, verbosity, eventData);
+    return eventData;
+  }
+
+  void DecayManager::GenerateEvent_TXT(int eventNr, int verbosity, std::string &eventData)
   {
     double time = 0.;
-    double checkTime = 0.;
     int subEventNr = 0;
     int totSubEvents = 0;
     int totEvents = 0;
-    std::ostringstream eventData;
-    std::ostringstream subHeader;
-    std::ostringstream subEventData;
+    // Scratch buffers reused from one event to the next by each thread
+    thread_local std::string subHeader;
+    thread_local std::string subEventData;
+    subHeader.clear();
+    subEventData.clear();
+    bool accepted = !eventFilter.enabled;
+    double weight = 1.;
+
+    // Same layout as Particle::GetInfoForFile, with the event number and the rounded time in front
+    auto particleLine = [&](const Particle *p)
+    {
+      const ublas::vector<double> &momentum = p->GetMomentum();
+      fmt::format_to(std::back_inserter(subEventData), "{}\t\t{:.4f}\t{}\t{:g}\t{:g}\t{:g}\t{:g}\t{:g}\t{:g}\n",
+                     eventNr, roundf(time * 10000) / 10000., p->GetRawName(), p->GetExcitationEnergy(), p->GetKinEnergy(),
+                     momentum(0), momentum(1), momentum(2), momentum(3));
+      if (!accepted)
+      {
+        const double mom = sqrt(pow(momentum(1), 2) + pow(momentum(2), 2) + pow(momentum(3), 2));
+        accepted = eventFilter.Accept(p->GetPDG(), time, p->GetKinEnergy(), momentum(1) / mom, momentum(2) / mom, momentum(3) / mom);
+      }
+    };
+
     std::vector<Particle *> particleStack;
     Particle *ini = GetNewParticle(initStatePDG);
     ini->SetExcitationEnergy(initExcitationEn);
+    ini->SetPlanNode(decayPlan.FindNode(initStatePDG, initExcitationEn));
 
     // SET INITIAL KIONETIC ENERGY TO 10keV and the momentuml only on the z axis
     ini->SetKinEnergy(0.0);
@@ -784,99 +1315,72 @@ namespace CRADLE
 
     particleStack.push_back(ini);
 
-    if (verbosity == 0)
+    while (!particleStack.empty())
     {
-      while (!particleStack.empty())
-      {
-        Particle *p = particleStack.back();
-        vector<Particle *> finalStates;
-        double decayTime = p->GetDecayTime();
-        // cout << "\n Decaying particle " << p->GetRawName() << endl;
-        //  std::cout << eventNr << "\t" << subEventNr << std::endl;
-        //  std::cout << "     Time =\t" << time      << "\n "
-        //   << "CheckTime =\t" << checkTime << "\n "
-        //   << "decayTime =\t" << decayTime << std::endl;
-
-        if (decayTime > configOptions.cuts.Lifetime && (find(RestrictedParticleList.begin(), RestrictedParticleList.end(), p->GetPDG()) != RestrictedParticleList.end()))
-        {
-          ++totSubEvents;
-          subEventData << eventNr << "\t\t" << std::fixed << std::setprecision(4) << roundf(time * 10000) / 10000. << "\t" << p->GetInfoForFile() << "\n";
-        }
-        if ((time + decayTime) <= configOptions.cuts.Lifetime)
-        {
-          try
-          {
-            time += decayTime;
-            finalStates = p->Decay();
-          }
-          catch (const std::invalid_argument &e)
-          {
-            std::cout << "Decay Mode for particle " << p->GetName() << " not found. Aborting." << endl;
-            return "";
-          }
-        }
+      Particle *p = particleStack.back();
+      vector<Particle *> finalStates;
+      double decayTime = GetDecayTime(p);
 
-        delete particleStack.back();
-        particleStack.pop_back();
-        if (!finalStates.empty())
-        {
-          particleStack.insert(particleStack.end(), finalStates.begin(),
-                               finalStates.end());
-        }
-      }
-    }
-    else
-    {
-      while (!particleStack.empty())
+      // With verbosity 0 only the restricted particles living longer than Lifetime or flying farther than Distance are written
+      const bool escaping = decayTime > configOptions.cuts.Lifetime || !IsFlightWithinCut(p, decayTime);
+      if (p->GetKinEnergy() <= configOptions.cuts.Energy && (verbosity != 0 || (escaping && IsRestrictedParticle(p->GetPDG()))))
       {
-        Particle *p = particleStack.back();
-        vector<Particle *> finalStates;
-        double decayTime = p->GetDecayTime();
-        // cout << "\n Decaying particle " << p->GetRawName() << endl;
-        //  std::cout << eventNr << "\t" << subEventNr << std::endl;
-        //  std::cout << "     Time =\t" << time      << "\n "
-        //   << "CheckTime =\t" << checkTime << "\n "
-        //   << "decayTime =\t" << decayTime << std::endl;
-
         ++totSubEvents;
-        subEventData << eventNr << "\t\t" << std::fixed << std::setprecision(4) << roundf(time * 10000) / 10000. << "\t" << p->GetInfoForFile() << "\n";
+        particleLine(p);
+      }
 
-        if ((time + decayTime) <= configOptions.cuts.Lifetime)
+      if (IsDecayedWithinCuts(p, time, decayTime))
+      {
+        try
         {
-          try
+          time += decayTime;
+          finalStates = DecayParticle(p, weight);
+          if (verbosity != 0)
           {
-            time += decayTime;
-            finalStates = p->Decay();
-            subHeader << eventNr << std::setw(8) << subEventNr << "\t\t" << totSubEvents << "\n"
-                      << subEventData.str();
-            subEventData.str(std::string());
+            fmt::format_to(std::back_inserter(subHeader), "{}{:>8}\t\t{}\n", eventNr, subEventNr, totSubEvents);
+            subHeader += subEventData;
+            subEventData.clear();
             totEvents += totSubEvents;
             totSubEvents = 0;
             ++subEventNr;
           }
-          catch (const std::invalid_argument &e)
-          {
-            std::cout << "Decay Mode for particle " << p->GetName() << " not found. Aborting." << endl;
-            return "";
-          }
         }
-
-        delete particleStack.back();
-        particleStack.pop_back();
-        if (!finalStates.empty())
+        catch (const std::invalid_argument &e)
         {
-          particleStack.insert(particleStack.end(), finalStates.begin(),
-                               finalStates.end());
+          std::cout << "Decay Mode for particle " << p->GetName() << " not found. Aborting." << endl;
+          for (Particle *q : particleStack)
+            delete q;
+          return;
         }
       }
+
+      delete particleStack.back();
+      particleStack.pop_back();
+      if (!finalStates.empty())
+      {
+        particleStack.insert(particleStack.end(), finalStates.begin(),
+                             finalStates.end());
+      }
+
+      if (!accepted && !CanPassFilter(particleStack, time))
+      {
+        for (Particle *q : particleStack)
+          delete q;
+        particleStack.clear();
+      }
     }
+    // Events rejected by the filter are not written
+    if (!accepted)
+      return;
     totEvents += totSubEvents;
-    subHeader << eventNr << std::setw(8) << subEventNr << "\t\t" << totSubEvents << "\n"
-              << subEventData.str();
-    eventData << eventNr << "\t\t" << totEvents << "\n"
-              << subHeader.str();
-
-    return eventData.str();
+    fmt::format_to(std::back_inserter(subHeader), "{}{:>8}\t\t{}\n", eventNr, subEventNr, totSubEvents);
+    subHeader += subEventData;
+    // The weight of the event follows its number of particles when channels are biased
+    if (decayPlan.IsBiased())
+      fmt::format_to(std::back_inserter(eventData), "{}\t\t{}\t{:g}\n", eventNr, totEvents, weight);
+    else
+      fmt::format_to(std::back_inserter(eventData), "{}\t\t{}\n", eventNr, totEvents);
+    eventData += subHeader;
   }
 
   bool DecayManager::MainLoop()
@@ -888,6 +1392,7 @@ namespace CRADLE
       Error("ERROR: Incorrect number of events (" + std::to_string(nrParticles) + ")");
       return false;
     }
+    CompileDecayPlan();
     Start("Generating " + std::to_string(nrParticles) + " events...");
 
     std::ios::sync_with_stdio(false);
@@ -895,7 +1400,60 @@ namespace CRADLE
     int steppingProgress = std::max(1, nrParticles / 10000);
     clock_t start = clock();
 
-    if (outputName.find("root") != std::string::npos)
+    if (!configOptions.histograms.Histogram.empty())
+    {
+      // Histogram mode: no event is written
+      if (!FillHistograms(nrParticles, start))
+        return false;
+    }
+    else if (outputName == "-" || outputName.compare(0, 5, "fifo:") == 0)
+    {
+      // Streamed output: the writer blocks while the reader is behind, which holds back
+      // the workers once the pending blocks are full
+      const std::string &format = configOptions.general.StreamFormat;
+      if (format != "TXT" && format != "CEV")
+      {
+        Error("Unknown stream format " + format + " (choose TXT or CEV)");
+        return false;
+      }
+      int fd = configOptions.general.OutputDescriptor;
+      if (outputName != "-")
+      {
+        const std::string path = outputName.substr(5);
+        struct stat info;
+        if (stat(path.c_str(), &info) == 0)
+        {
+          if (!S_ISFIFO(info.st_mode))
+          {
+            Error(path + " exists and is not a FIFO");
+            return false;
+          }
+        }
+        else if (mkfifo(path.c_str(), 0644) != 0)
+        {
+          Error("Could not create FIFO " + path);
+          return false;
+        }
+        Info("Waiting for a reader on " + path);
+        fd = open(path.c_str(), O_WRONLY);
+      }
+      if (fd < 0)
+      {
+        Error("Could not open output stream " + outputName);
+        return false;
+      }
+      // A reader leaving the stream makes write fail with EPIPE instead of killing the process
+      struct sigaction ignorePipe, previousPipe;
+      std::memset(&ignorePipe, 0, sizeof(ignorePipe));
+      ignorePipe.sa_handler = SIG_IGN;
+      sigaction(SIGPIPE, &ignorePipe, &previousPipe);
+      bool written = (format == "TXT") ? WriteEvents_TXT(fd, compression::Format::None, verbosity, start) : WriteEvents_CEV(fd, false, verbosity, start);
+      sigaction(SIGPIPE, &previousPipe, nullptr);
+      close(fd);
+      if (!written)
+        return false;
+    }
+    else if (outputName.find("root") != std::string::npos)
     {
       // outputFile = new TFile(outputName.c_str(), "RECREATE");
       // if (!outputFile->IsOpen())
@@ -965,110 +1523,273 @@ namespace CRADLE
       // ROOT::EnableImplicitMT(NRTHREADS); // not needed with TThreadExecutor
 
       std::atomic<int> show_progress{0};
+      auto progress = [&]()
+      {
+        const int done = ++show_progress;
+        if (done % steppingProgress == 0 || done == nrParticles)
+        {
+          ProgressBar(done, nrParticles, start, "", steppingProgress, NRTHREADS);
+        }
+      };
 
+      const std::string &layout = configOptions.general.Layout;
+      if (layout != "Vector" && layout != "Flat" && layout != "RNTuple")
       {
-        // Keep merger inside a scope so it is destroyed before reopening the file
-        ROOT::TBufferMerger merger(outputName.c_str(), "RECREATE");
-        ROOT::TThreadExecutor executor(NRTHREADS);
+        Error("Unknown ROOT output layout " + layout + " (choose Vector, Flat or RNTuple)");
+        return false;
+      }
+      const std::string &precision = configOptions.general.OutputPrecision;
+      if (precision != "Full" && precision != "Compact")
+      {
+        Error("Unknown ROOT output precision " + precision + " (choose Full or Compact)");
+        return false;
+      }
+      const bool compact = (precision == "Compact");
+      const bool weighted = decayPlan.IsBiased();
+      codeTable.Clear();
+
+      int compression = ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose;
+      const std::string &algorithm = configOptions.general.Compression;
+      if (algorithm != "Default")
+      {
+        static const std::map<std::string, ROOT::RCompressionSetting::EAlgorithm::EValues> algorithms = {
+            {"ZLIB", ROOT::RCompressionSetting::EAlgorithm::kZLIB},
+            {"LZMA", ROOT::RCompressionSetting::EAlgorithm::kLZMA},
+            {"LZ4", ROOT::RCompressionSetting::EAlgorithm::kLZ4},
+            {"ZSTD", ROOT::RCompressionSetting::EAlgorithm::kZSTD}};
+        auto it = algorithms.find(algorithm);
+        if (it == algorithms.end())
+        {
+          Error("Unknown compression algorithm " + algorithm + " (choose Default, ZLIB, LZMA, LZ4 or ZSTD)");
+          return false;
+        }
+        compression = ROOT::CompressionSettings(it->second, configOptions.general.CompressionLevel);
+      }
+      const int basketSize = configOptions.general.BasketSize;
+      const Long64_t autoFlush = configOptions.general.AutoFlush;
+
+      const int chunkSize = 1000000;
+      std::vector<std::pair<int, int>> ranges;
+      ranges.reserve((nrParticles + chunkSize - 1) / chunkSize);
 
-        const int chunkSize = 1000000;
-        std::vector<std::pair<int, int>> ranges;
-        ranges.reserve((nrParticles + chunkSize - 1) / chunkSize);
+      for (int first = 0; first < nrParticles; first += chunkSize)
+      {
+        ranges.emplace_back(first, std::min(first + chunkSize, nrParticles));
+      }
 
-        for (int first = 0; first < nrParticles; first += chunkSize)
+      if (layout == "RNTuple")
+      {
+#ifdef CRADLE_RNTUPLE
+        // Flat particle table written as an RNTuple. Every task has its own fill context
+        // and binds the entry fields directly to the rows of its particle buffer.
+        // Keep writer inside a scope so the file is closed before reopening it
+        auto model = ROOT::RNTupleModel::CreateBare();
+        model->MakeField<int>("event");
+        model->MakeField<int>("multiplicity");
+        if (weighted)
+          model->MakeField<double>("weight");
+        if (compact)
         {
-          ranges.emplace_back(first, std::min(first + chunkSize, nrParticles));
+          model->MakeField<std::uint16_t>("code");
+          for (const char *name : {"time", "energy", "excitation_energy", "p"})
+            model->MakeField<float>(name);
+          // Same 12 bit mantissa as a Float16_t without range
+          for (const char *name : {"px", "py", "pz"})
+          {
+            auto field = std::make_unique<ROOT::RField<float>>(name);
+            field->SetTruncated(21);
+            model->AddField(std::move(field));
+          }
         }
+        else
+        {
+          model->MakeField<int>("code");
+          for (const char *name : {"time", "energy", "excitation_energy", "p", "px", "py", "pz"})
+            model->MakeField<double>(name);
+        }
+        ROOT::RNTupleWriteOptions options;
+        if (algorithm != "Default")
+          options.SetCompression(compression);
+        auto writer = ROOT::RNTupleParallelWriter::Recreate(std::move(model), "ParticleTree", outputName, options);
+        ROOT::TThreadExecutor executor(NRTHREADS);
+
+        executor.Foreach([&](const std::pair<int, int> &range)
+                         {
+        auto context = writer->CreateFillContext();
+        auto entry = context->CreateEntry();
+        const auto eventToken = entry->GetToken("event");
+        const auto multiplicityToken = entry->GetToken("multiplicity");
+        const auto codeToken = entry->GetToken("code");
+        const auto timeToken = entry->GetToken("time");
+        const auto energyToken = entry->GetToken("energy");
+        const auto excitationToken = entry->GetToken("excitation_energy");
+        const auto pToken = entry->GetToken("p");
+        const auto pxToken = entry->GetToken("px");
+        const auto pyToken = entry->GetToken("py");
+        const auto pzToken = entry->GetToken("pz");
+        const auto weightToken = weighted ? entry->GetToken("weight") : decltype(eventToken)();
+
+        auto bindRow = [&](auto &columns, std::size_t k) {
+            entry->BindRawPtr(codeToken, &columns.code[k]);
+            entry->BindRawPtr(timeToken, &columns.time[k]);
+            entry->BindRawPtr(energyToken, &columns.kinetic_energy[k]);
+            entry->BindRawPtr(excitationToken, &columns.excitation_energy[k]);
+            entry->BindRawPtr(pToken, &columns.p[k]);
+            entry->BindRawPtr(pxToken, &columns.px[k]);
+            entry->BindRawPtr(pyToken, &columns.py[k]);
+            entry->BindRawPtr(pzToken, &columns.pz[k]);
+        };
+
+        ParticleBuffer buffer;
+        CompactParticleBuffer compactBuffer;
 
-        std::atomic<int> treeCounter{0};
+        for (int i = range.first; i < range.second; ++i) {
+            buffer.Clear();
+            GenerateEvent(i, verbosity, buffer);
+            if (compact)
+                compactBuffer.Assign(buffer, codeTable);
+
+            for (std::size_t k = 0; k < buffer.Size(); ++k) {
+                entry->BindRawPtr(eventToken, &buffer.event[k]);
+                entry->BindRawPtr(multiplicityToken, &buffer.multiplicity[k]);
+                if (weighted)
+                    entry->BindRawPtr(weightToken, &buffer.weight[k]);
+                if (compact)
+                    bindRow(compactBuffer, k);
+                else
+                    bindRow(buffer, k);
+                context->Fill(*entry);
+            }
+
+            progress();
+        } }, ranges);
+#else
+        Error("RNTuple output requires ROOT 6.36 or later");
+        return false;
+#endif
+      }
+      else
+      {
+        // Every task fills its own ParticleTree in memory; the merger appends them to the single
+        // ParticleTree of the output file as they are written, so no merge pass is needed afterwards.
+        // Keep merger inside a scope so it is destroyed before reopening the file
+        ROOT::TBufferMerger merger(outputName.c_str(), "RECREATE", compression);
+        ROOT::TThreadExecutor executor(NRTHREADS);
+        const bool flat = (layout == "Flat");
 
         executor.Foreach([&](const std::pair<int, int> &range)
                          {
         auto file = merger.GetFile();
         file->cd();
 
-        // Unique tree name per task/chunk
-        const int treeId = treeCounter++;
-        const std::string treeName = "ParticleTree_" + std::to_string(treeId);
-
-        TTree tree(treeName.c_str(), "ParticleTree");
+        TTree tree("ParticleTree", "ParticleTree");
         tree.SetDirectory(file.get());
 
-        std::vector<double> Time, Kinetic_energy, Excitation_energy, p, Px, Py, Pz;
-        std::vector<int> Code;
-
-        tree.Branch("time",              &Time);
-        tree.Branch("code",              &Code);
-        tree.Branch("energy",    &Kinetic_energy);
-        tree.Branch("excitation_energy", &Excitation_energy);
-        tree.Branch("p",                 &p);
-        tree.Branch("px",                &Px);
-        tree.Branch("py",                &Py);
-        tree.Branch("pz",                &Pz);
-
-        tree.SetAutoFlush(-20 * 1024 * 1024);
-
-        std::vector<ParticleData> particles;
-        particles.reserve(16);
+        // Particles are generated straight into the columns of the buffer
+        ParticleBuffer buffer;
+        CompactParticleBuffer compactBuffer;
+        int event = 0, multiplicity = 0, code = 0;
+        unsigned short compactCode = 0;
+        double weight = 1.;
+        double time = 0., energy = 0., excitation_energy = 0., p = 0., px = 0., py = 0., pz = 0.;
+        float compactTime = 0., compactEnergy = 0., compactExcitation = 0., compactP = 0.;
+        Float16_t compactPx = 0., compactPy = 0., compactPz = 0.;
+
+        if (flat) {
+            // One entry per particle
+            tree.Branch("event",        &event,        "event/I", basketSize);
+            tree.Branch("multiplicity", &multiplicity, "multiplicity/I", basketSize);
+            if (weighted)
+                tree.Branch("weight", &weight, "weight/D", basketSize);
+            if (compact) {
+                tree.Branch("code",              &compactCode,       "code/s", basketSize);
+                tree.Branch("time",              &compactTime,       "time/F", basketSize);
+                tree.Branch("energy",            &compactEnergy,     "energy/F", basketSize);
+                tree.Branch("excitation_energy", &compactExcitation, "excitation_energy/F", basketSize);
+                tree.Branch("p",                 &compactP,          "p/F", basketSize);
+                tree.Branch("px",                &compactPx,         "px/f[-1,1,16]", basketSize);
+                tree.Branch("py",                &compactPy,         "py/f[-1,1,16]", basketSize);
+                tree.Branch("pz",                &compactPz,         "pz/f[-1,1,16]", basketSize);
+            }
+            else {
+                tree.Branch("code",              &code,              "code/I", basketSize);
+                tree.Branch("time",              &time,              "time/D", basketSize);
+                tree.Branch("energy",            &energy,            "energy/D", basketSize);
+                tree.Branch("excitation_energy", &excitation_energy, "excitation_energy/D", basketSize);
+                tree.Branch("p",                 &p,                 "p/D", basketSize);
+                tree.Branch("px",                &px,                "px/D", basketSize);
+                tree.Branch("py",                &py,                "py/D", basketSize);
+                tree.Branch("pz",                &pz,                "pz/D", basketSize);
+            }
+        }
+        else {
+            // One entry per event, the branches point to the buffer columns
+            auto branchColumns = [&](auto &columns) {
+                tree.Branch("time",              &columns.time, basketSize);
+                tree.Branch("code",              &columns.code, basketSize);
+                tree.Branch("energy",            &columns.kinetic_energy, basketSize);
+                tree.Branch("excitation_energy", &columns.excitation_energy, basketSize);
+                tree.Branch("p",                 &columns.p, basketSize);
+                tree.Branch("px",                &columns.px, basketSize);
+                tree.Branch("py",                &columns.py, basketSize);
+                tree.Branch("pz",                &columns.pz, basketSize);
+            };
+            if (compact)
+                branchColumns(compactBuffer);
+            else
+                branchColumns(buffer);
+            if (weighted)
+                tree.Branch("weight", &weight, "weight/D", basketSize);
+        }
 
-        Time.reserve(16);
-        Code.reserve(16);
-        Kinetic_energy.reserve(16);
-        Excitation_energy.reserve(16);
-        p.reserve(16);
-        Px.reserve(16);
-        Py.reserve(16);
-        Pz.reserve(16);
+        tree.SetAutoFlush(autoFlush);
 
         for (int i = range.first; i < range.second; ++i) {
-            particles = this->GenerateEvent_ROOT(i, verbosity);
-            const std::size_t n = particles.size();
-
-            Time.clear();
-            Code.clear();
-            Kinetic_energy.clear();
-            Excitation_energy.clear();
-            p.clear();
-            Px.clear();
-            Py.clear();
-            Pz.clear();
-
-            if (Time.capacity() < n)              Time.reserve(n);
-            if (Code.capacity() < n)              Code.reserve(n);
-            if (Kinetic_energy.capacity() < n)    Kinetic_energy.reserve(n);
-            if (Excitation_energy.capacity() < n) Excitation_energy.reserve(n);
-            if (p.capacity() < n)                 p.reserve(n);
-            if (Px.capacity() < n)                Px.reserve(n);
-            if (Py.capacity() < n)                Py.reserve(n);
-            if (Pz.capacity() < n)                Pz.reserve(n);
-
-            for (const auto& particle : particles) {
-                Time.push_back(particle.time);
-                Code.push_back(particle.code);
-                Kinetic_energy.push_back(particle.kinetic_energy);
-                Excitation_energy.push_back(particle.excitation_energy);
-                p.push_back(particle.p);
-                Px.push_back(particle.px);
-                Py.push_back(particle.py);
-                Pz.push_back(particle.pz);
+            buffer.Clear();
+            GenerateEvent(i, verbosity, buffer);
+            if (compact)
+                compactBuffer.Assign(buffer, codeTable);
+
+            if (flat) {
+                for (std::size_t k = 0; k < buffer.Size(); ++k) {
+                    event = buffer.event[k];
+                    multiplicity = buffer.multiplicity[k];
+                    weight = buffer.weight[k];
+                    if (compact) {
+                        compactCode = compactBuffer.code[k];
+                        compactTime = compactBuffer.time[k];
+                        compactEnergy = compactBuffer.kinetic_energy[k];
+                        compactExcitation = compactBuffer.excitation_energy[k];
+                        compactP = compactBuffer.p[k];
+                        compactPx = compactBuffer.px[k];
+                        compactPy = compactBuffer.py[k];
+                        compactPz = compactBuffer.pz[k];
+                    }
+                    else {
+                        code = buffer.code[k];
+                        time = buffer.time[k];
+                        energy = buffer.kinetic_energy[k];
+                        excitation_energy = buffer.excitation_energy[k];
+                        p = buffer.p[k];
+                        px = buffer.px[k];
+                        py = buffer.py[k];
+                        pz = buffer.pz[k];
+                    }
+                    tree.Fill();
+                }
             }
-
-            tree.Fill();
-
-            const int done = ++show_progress;
-            if (done % steppingProgress == 0 || done == nrParticles) {
-                ProgressBar(done, nrParticles, start, "", steppingProgress, NRTHREADS);
+            else if (buffer.Size() > 0 || !eventFilter.enabled) {
+                // Events rejected by the filter get no entry
+                weight = buffer.Size() > 0 ? buffer.weight[0] : 1.;
+                tree.Fill();
             }
+
+            progress();
         }
 
-        file->cd();
-        tree.Write("", TObject::kOverwrite);
         file->Write(); }, ranges);
-
       }
 
-      MergeParticleTreesInPlace(outputName);
-      
       outputFile = new TFile(outputName.c_str(), "UPDATE");
       if (!outputFile->IsOpen())      {
         Error("Could not open output file " + outputName);
@@ -1085,43 +1806,699 @@ namespace CRADLE
       }
       // Writting config file
       WriteConfigData(ConfigFilename);
+      // Writting code table of the compact profile
+      if (compact)
+      {
+        outputFile->cd();
+        TTree codeTree("CodeTable", "PDG code of each code index of ParticleTree");
+        unsigned short index = 0;
+        int code = 0;
+        codeTree.Branch("index", &index, "index/s");
+        codeTree.Branch("code", &code, "code/I");
+        for (int c : codeTable.GetCodes())
+        {
+          code = c;
+          codeTree.Fill();
+          ++index;
+        }
+        codeTree.Write();
+      }
       outputFile->Close();
 
       ///////////////////////////////////////////////////
     }
 
-    else if (outputName.find("txt") != std::string::npos)
+    else if (outputName.find("txt") != std::string::npos || outputName.find("cev") != std::string::npos)
+    {
+      const bool txt = outputName.find("txt") != std::string::npos;
+      // .txt.gz and .txt.zst: every block is compressed by its worker into an independent
+      // gzip member or zstd frame, so the writer only appends them
+      const compression::Format format = txt ? compression::GetFormat(outputName) : compression::Format::None;
+      if (!compression::IsAvailable(format))
+      {
+        Error("CRADLE++ was built without support for the compression of " + outputName);
+        return false;
+      }
+
+      int fd = open(outputName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (fd < 0)
+      {
+        Error("Could not open output file " + outputName);
+        return false;
+      }
+      bool written = txt ? WriteEvents_TXT(fd, format, verbosity, start) : WriteEvents_CEV(fd, true, verbosity, start);
+      close(fd);
+      if (!written)
+        return false;
+    }
+    else
+    {
+      Error("Choose .txt, .cev or .root for your output file, - for stdout or fifo:[path]");
+      return false;
+    }
+
+    Success(Form("Done! Generated in %.1f seconds.", (double)(clock() - start) / CLOCKS_PER_SEC / NRTHREADS));
+    return true;
+  }
+
+  bool DecayManager::WriteToDescriptor(int fd, const char *data, std::size_t size)
+  {
+    while (size > 0)
+    {
+      ssize_t n = write(fd, data, size);
+      if (n < 0)
+      {
+        if (errno == EINTR)
+          continue;
+        return false;
+      }
+      data += n;
+      size -= n;
+    }
+    return true;
+  }
+
+  bool DecayManager::WriteEvents_TXT(int fd, compression::Format format, int verbosity, clock_t start)
+  {
+    const int nrEvents = configOptions.general.Loop;
+    const int blockSize = (format == compression::Format::None ? 1 : 4) * utilities::BATCH_SIZE;
+    bool written = true;
+
+    GenerateBlocks(nrEvents, blockSize, start, [&](int first, int last, std::string &block)
+                   {
+      for (int i = first; i < last; i++)
+        GenerateEvent_TXT(i, verbosity, block);
+      if (!compression::CompressBlock(format, block))
+        Error("Could not compress the output block of events " + std::to_string(first) + " to " + std::to_string(last - 1)); }, [&](const std::string &block)
+                   { return written = WriteToDescriptor(fd, block.data(), block.size()); });
+
+    if (!written)
+      Error("Could not write the events to " + outputName);
+    return written;
+  }
+
+  bool DecayManager::WriteEvents_CEV(int fd, bool seekable, int verbosity, clock_t start)
+  {
+    const uint16_t endianness = 1;
+    if (*reinterpret_cast<const unsigned char *>(&endianness) != 1)
+    {
+      Error("The .cev output is only available on little-endian machines");
+      return false;
+    }
+    const int nrEvents = configOptions.general.Loop;
+    const int blockSize = 16 * utilities::BATCH_SIZE;
+
+    // Everything but the offsets of the trailer is known before the loop, so that
+    // a stream reader can rely on the header written first
+    cev::CevHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, cev::Magic, sizeof(cev::Magic));
+    header.version = cev::Version;
+    header.headerSize = sizeof(header);
+    std::ifstream configFile(ConfigFilename, std::ios::binary);
+    std::string configContent((std::istreambuf_iterator<char>(configFile)), std::istreambuf_iterator<char>());
+    header.configHash = cev::Hash(configContent.data(), configContent.size());
+    header.seed = 0; // unset, the events are not drawn from one seeded engine
+    header.nEvents = nrEvents;
+    header.nChunks = (nrEvents + blockSize - 1) / blockSize;
+    header.branchingRatio = decayPlan.GetBranchingRatio();
+
+    bool written = WriteToDescriptor(fd, reinterpret_cast<const char *>(&header), sizeof(header));
+    uint64_t offset = sizeof(header);
+    std::vector<uint64_t> chunkOffsets;
+    codeTable.Clear();
+
+    // One chunk per block of events, built by the workers and appended in order
+    GenerateBlocks(nrEvents, blockSize, start, [&](int first, int last, std::string &block)
+                   {
+      // Workers are started for this loop only, so their per-thread buffers start empty
+      thread_local ParticleBuffer buffer;
+      thread_local std::unordered_map<int, unsigned short> codeCache;
+      buffer.Clear();
+
+      const uint32_t nEvents = last - first;
+      std::vector<uint32_t> offsets(1, 0);
+      offsets.reserve(nEvents + 1);
+      for (int i = first; i < last; i++) {
+        GenerateEvent(i, verbosity, buffer);
+        offsets.push_back(buffer.Size());
+      }
+
+      cev::CevChunkHeader chunkHeader;
+      chunkHeader.firstEvent = first;
+      chunkHeader.nEvents = nEvents;
+      chunkHeader.nParticles = buffer.Size();
+      const std::size_t particleOffset = cev::ParticleOffset(nEvents);
+      block.assign(cev::Align(particleOffset + buffer.Size() * sizeof(cev::CevParticle)), '\0');
+      std::memcpy(&block[0], &chunkHeader, sizeof(chunkHeader));
+      std::memcpy(&block[sizeof(chunkHeader)], offsets.data(), offsets.size() * sizeof(uint32_t));
+
+      cev::CevParticle *particles = reinterpret_cast<cev::CevParticle *>(&block[particleOffset]);
+      for (std::size_t k = 0; k < buffer.Size(); ++k) {
+        if (codeCache.find(buffer.code[k]) == codeCache.end())
+          codeCache.emplace(buffer.code[k], codeTable.GetIndex(buffer.code[k]));
+        particles[k].code = buffer.code[k];
+        particles[k].weight = buffer.weight[k];
+        particles[k].time = buffer.time[k];
+        particles[k].excitation_energy = buffer.excitation_energy[k];
+        particles[k].kinetic_energy = buffer.kinetic_energy[k];
+        particles[k].p = buffer.p[k];
+        particles[k].px = buffer.px[k];
+        particles[k].py = buffer.py[k];
+        particles[k].pz = buffer.pz[k];
+      } }, [&](const std::string &block)
+                   {
+      chunkOffsets.push_back(offset);
+      written = WriteToDescriptor(fd, block.data(), block.size());
+      offset += block.size();
+      return written; });
+
+    // Chunk index and PDG table; a file also gets its completed header, in a stream
+    // chunkIndexOffset stays 0 and the PDG table runs to the end of the stream
+    const std::vector<int> codes = codeTable.GetCodes();
+    const std::vector<int32_t> pdgTable(codes.begin(), codes.end());
+    header.chunkIndexOffset = offset;
+    header.pdgTableOffset = offset + chunkOffsets.size() * sizeof(uint64_t);
+    header.nCodes = pdgTable.size();
+    written = written && WriteToDescriptor(fd, reinterpret_cast<const char *>(chunkOffsets.data()), chunkOffsets.size() * sizeof(uint64_t));
+    written = written && WriteToDescriptor(fd, reinterpret_cast<const char *>(pdgTable.data()), pdgTable.size() * sizeof(int32_t));
+    if (seekable)
+      written = written && pwrite(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header));
+
+    if (!written)
+      Error("Could not write the events to " + outputName);
+    return written;
+  }
+
+  HistogramDefinition DecayManager::ParseHistogramDefinition(const std::string &definition)
+  {
+    static const std::map<std::string, std::vector<double> ParticleBuffer::*> columns = {
+        {"time", &ParticleBuffer::time},
+        {"energy", &ParticleBuffer::kinetic_energy},
+        {"excitation_energy", &ParticleBuffer::excitation_energy},
+        {"p", &ParticleBuffer::p},
+        {"px", &ParticleBuffer::px},
+        {"py", &ParticleBuffer::py},
+        {"pz", &ParticleBuffer::pz}};
+
+    std::vector<std::string> fields;
+    std::stringstream stream(definition);
+    std::string field;
+    while (std::getline(stream, field, ':'))
+      fields.push_back(field);
+    if (fields.size() != 5 && fields.size() != 6)
+      Error("Histogram " + definition + " is not variable:particle:bins:min:max[:cut]");
+
+    auto toCode = [&](const std::string &name)
+    {
+      if (name == "all")
+        return 0;
+      auto it = NametoCode_map.find(name);
+      if (it == NametoCode_map.end())
+        Error("Unknown particle " + name + " in histogram " + definition);
+      return it->second;
+    };
+    auto toColumn = [&](const std::string &variable)
     {
-      int show_progress = 0;
-      std::ofstream fileStream;
-      fileStream.open(outputName.c_str());
-      for (int i = 0; i < nrParticles; i += NRTHREADS)
+      auto it = columns.find(variable);
+      if (it == columns.end())
+        Error("Unknown variable " + variable + " in histogram " + definition);
+      return it->second;
+    };
+
+    HistogramDefinition histogram;
+    histogram.variable = fields[0];
+    if (histogram.variable == "cos")
+    {
+      std::size_t slash = fields[1].find('/');
+      if (slash == std::string::npos)
+        Error("Histogram " + definition + " needs two particles for cos (particle1/particle2)");
+      histogram.code = toCode(fields[1].substr(0, slash));
+      histogram.secondCode = toCode(fields[1].substr(slash + 1));
+    }
+    else
+    {
+      histogram.column = toColumn(histogram.variable);
+      histogram.code = toCode(fields[1]);
+    }
+
+    try
+    {
+      histogram.bins = std::stoi(fields[2]);
+      histogram.min = std::stod(fields[3]);
+      histogram.max = std::stod(fields[4]);
+      if (fields.size() == 6)
       {
-        // cout << "LOOP NR " << i+1 << endl;
-        const int threads = std::min(NRTHREADS, nrParticles - i);
-        std::vector<std::future<std::string>> f(threads);
-        for (int t = 0; t < threads; t++)
+        std::size_t op = fields[5].find_first_of("<>");
+        if (op == std::string::npos)
+          Error("Cut of histogram " + definition + " is not variable>value or variable<value");
+        histogram.cutColumn = toColumn(fields[5].substr(0, op));
+        histogram.cutAbove = (fields[5][op] == '>');
+        histogram.cutValue = std::stod(fields[5].substr(op + 1));
+      }
+    }
+    catch (const std::exception &e)
+    {
+      Error("Incorrect number in histogram " + definition);
+    }
+    if (histogram.bins < 1 || histogram.max <= histogram.min)
+      Error("Incorrect binning in histogram " + definition);
+    return histogram;
+  }
+
+  bool DecayManager::FillHistograms(int nrEvents, clock_t start)
+  {
+    if (outputName.find("root") == std::string::npos)
+    {
+      Error("Choose a .root output file for the histograms");
+      return false;
+    }
+    const int verbosity = configOptions.general.Verbosity_file;
+
+    std::vector<HistogramDefinition> histograms;
+    for (std::size_t h = 0; h < configOptions.histograms.Histogram.size(); ++h)
+    {
+      histograms.push_back(ParseHistogramDefinition(configOptions.histograms.Histogram[h]));
+      histograms.back().name = "H" + std::to_string(h);
+    }
+
+    // Bin contents with the underflow and overflow bins, as in a TH1, and the sums of the
+    // squared weights for the errors of weighted events
+    std::vector<std::vector<double>> contents(histograms.size());
+    std::vector<std::vector<double>> sumw2(histograms.size());
+    std::vector<long long> entries(histograms.size(), 0);
+    for (std::size_t h = 0; h < histograms.size(); ++h)
+      contents[h].assign(histograms[h].bins + 2, 0.);
+    sumw2 = contents;
+    const bool weighted = decayPlan.IsBiased();
+
+    const int blockSize = utilities::BATCH_SIZE;
+    const int nrBlocks = (nrEvents + blockSize - 1) / blockSize;
+    const int steppingProgress = std::max(1, nrEvents / 10000);
+    std::atomic<int> nextBlock{0};
+    std::atomic<int> show_progress{0};
+    std::mutex mergeMutex;
+
+    auto worker = [&]()
+    {
+      // Histograms of the thread, merged once all its events are generated
+      std::vector<std::vector<double>> localContents = contents;
+      std::vector<std::vector<double>> localSumw2 = sumw2;
+      std::vector<long long> localEntries(histograms.size(), 0);
+      ParticleBuffer buffer;
+
+      auto passCut = [&](const HistogramDefinition &histogram, std::size_t k)
+      {
+        if (histogram.cutColumn == nullptr)
+          return true;
+        const double value = (buffer.*histogram.cutColumn)[k];
+        return histogram.cutAbove ? value > histogram.cutValue : value < histogram.cutValue;
+      };
+      auto fill = [&](std::size_t h, double value)
+      {
+        const HistogramDefinition &histogram = histograms[h];
+        int bin = 0;
+        if (value >= histogram.max)
+          bin = histogram.bins + 1;
+        else if (value >= histogram.min)
+          bin = std::min(histogram.bins, 1 + static_cast<int>((value - histogram.min) / (histogram.max - histogram.min) * histogram.bins));
+        const double weight = buffer.weight.empty() ? 1. : buffer.weight[0];
+        localContents[h][bin] += weight;
+        localSumw2[h][bin] += weight * weight;
+        ++localEntries[h];
+      };
+
+      for (int b = nextBlock++; b < nrBlocks; b = nextBlock++)
+      {
+        const int last = std::min(nrEvents, (b + 1) * blockSize);
+        for (int i = b * blockSize; i < last; ++i)
         {
-          f[t] = std::async(std::launch::async, &DecayManager::GenerateEvent_TXT, this, i + t, verbosity);
+          buffer.Clear();
+          GenerateEvent(i, verbosity, buffer);
+
+          for (std::size_t h = 0; h < histograms.size(); ++h)
+          {
+            const HistogramDefinition &histogram = histograms[h];
+            if (histogram.column != nullptr)
+            {
+              for (std::size_t k = 0; k < buffer.Size(); ++k)
+              {
+                if ((histogram.code == 0 || buffer.code[k] == histogram.code) && passCut(histogram, k))
+                  fill(h, (buffer.*histogram.column)[k]);
+              }
+            }
+            else
+            {
+              // Angle between the first particles of the event with the two codes, the cut applies to the first one
+              int first = -1, second = -1;
+              for (std::size_t k = 0; k < buffer.Size() && (first < 0 || second < 0); ++k)
+              {
+                if (first < 0 && (histogram.code == 0 || buffer.code[k] == histogram.code) && passCut(histogram, k))
+                  first = k;
+                else if (second < 0 && (histogram.secondCode == 0 || buffer.code[k] == histogram.secondCode))
+                  second = k;
+              }
+              if (first >= 0 && second >= 0)
+                fill(h, buffer.px[first] * buffer.px[second] + buffer.py[first] * buffer.py[second] + buffer.pz[first] * buffer.pz[second]);
+            }
+          }
+
+          const int done = ++show_progress;
+          if (done % steppingProgress == 0 || done == nrEvents)
+            ProgressBar(done, nrEvents, start, "", steppingProgress, NRTHREADS);
         }
+      }
 
-        for (int t = 0; t < threads; t++)
+      std::lock_guard<std::mutex> lock(mergeMutex);
+      for (std::size_t h = 0; h < histograms.size(); ++h)
+      {
+        for (std::size_t bin = 0; bin < contents[h].size(); ++bin)
         {
-          fileStream << f[t].get();
-          show_progress++;
-          ProgressBar(show_progress, nrParticles, start, "", steppingProgress, NRTHREADS);
+          contents[h][bin] += localContents[h][bin];
+          sumw2[h][bin] += localSumw2[h][bin];
         }
+        entries[h] += localEntries[h];
       }
-      fileStream.flush();
-      fileStream.close();
+    };
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < NRTHREADS; t++)
+      workers.emplace_back(worker);
+    for (auto &w : workers)
+      w.join();
+
+    outputFile = new TFile(outputName.c_str(), "RECREATE");
+    if (!outputFile->IsOpen())
+    {
+      Error("Could not open output file " + outputName);
+      return false;
     }
-    else
+    for (std::size_t h = 0; h < histograms.size(); ++h)
+    {
+      const HistogramDefinition &histogram = histograms[h];
+      TH1D hist(histogram.name.c_str(), (configOptions.histograms.Histogram[h] + ";" + histogram.variable + ";Counts").c_str(), histogram.bins, histogram.min, histogram.max);
+      for (int bin = 0; bin < histogram.bins + 2; ++bin)
+        hist.SetBinContent(bin, contents[h][bin]);
+      if (weighted)
+      {
+        hist.Sumw2();
+        for (int bin = 0; bin < histogram.bins + 2; ++bin)
+          hist.SetBinError(bin, sqrt(sumw2[h][bin]));
+      }
+      hist.SetEntries(entries[h]);
+      hist.Write();
+    }
+    // Writting Data File
+    for (const auto &p : registeredParticles)
+    {
+      if (p.second->GetDecayChannels().size() > 0)
+      {
+        WriteDecayData(configOptions.envOptions.Radiationdata + "/z" + std::to_string(p.second->GetCharge()) + ".a" + std::to_string(p.second->GetNeutrons()+p.second->GetCharge()), "Radiation");
+        WriteDecayData(configOptions.envOptions.Gammadata + "/z" + std::to_string(p.second->GetCharge()) + ".a" + std::to_string(p.second->GetNeutrons()+p.second->GetCharge()), "Gamma");
+      }
+    }
+    // Writting config file
+    WriteConfigData(ConfigFilename);
+    outputFile->Close();
+    return true;
+  }
+
+  void DecayManager::GenerateBlocks(int nrEvents, int blockSize, clock_t start, const std::function<void(int, int, std::string &)> &generate, const std::function<bool(const std::string &)> &write)
+  {
+    // Persistent workers generate blocks of consecutive events in their own buffer; the calling
+    // thread writes the blocks in event order. At most maxPending blocks wait to be written.
+    // The first failed write stops the workers, the remaining events are not generated.
+    const int nrBlocks = (nrEvents + blockSize - 1) / blockSize;
+    const int maxPending = 4 * NRTHREADS;
+    const int steppingProgress = std::max(1, nrEvents / 10000);
+
+    std::atomic<int> nextBlock{0};
+    std::mutex pendingMutex;
+    std::condition_variable blockReady, blockWritten;
+    std::map<int, std::string> pendingBlocks;
+    int writtenBlocks = 0;
+    bool stopped = false;
+
+    std::vector<std::thread> workers;
+    workers.reserve(NRTHREADS);
+    for (int t = 0; t < NRTHREADS; t++)
     {
-      Error("Choose .txt or .root for your output file");
+      workers.emplace_back([&]
+                           {
+        for (int b = nextBlock++; b < nrBlocks; b = nextBlock++) {
+          {
+            std::unique_lock<std::mutex> lock(pendingMutex);
+            blockWritten.wait(lock, [&] { return stopped || b < writtenBlocks + maxPending; });
+            if (stopped)
+              break;
+          }
+          std::string block;
+          generate(b * blockSize, std::min(nrEvents, (b + 1) * blockSize), block);
+          {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            pendingBlocks.emplace(b, std::move(block));
+          }
+          blockReady.notify_one();
+        } });
+    }
+
+    int show_progress = 0;
+    for (int b = 0; b < nrBlocks; b++)
+    {
+      std::string block;
+      {
+        std::unique_lock<std::mutex> lock(pendingMutex);
+        blockReady.wait(lock, [&] { return !pendingBlocks.empty() && pendingBlocks.begin()->first == b; });
+        block = std::move(pendingBlocks.begin()->second);
+        pendingBlocks.erase(pendingBlocks.begin());
+        writtenBlocks = b + 1;
+      }
+      blockWritten.notify_all();
+
+      if (!write(block))
+      {
+        {
+          std::lock_guard<std::mutex> lock(pendingMutex);
+          stopped = true;
+        }
+        blockWritten.notify_all();
+        break;
+      }
+      const int last = std::min(nrEvents, (b + 1) * blockSize);
+      for (int i = b * blockSize; i < last; i++)
+      {
+        show_progress++;
+        ProgressBar(show_progress, nrEvents, start, "", steppingProgress, NRTHREADS);
+      }
+    }
+    for (auto &worker : workers)
+      worker.join();
+  }
+
+  bool DecayManager::SpectrumLoop(double stepSize)
+  {
+    if (stepSize <= 0.)
+    {
+      Error(Form("ERROR: Incorrect spectrum step (%.3f keV)", stepSize));
+      return false;
+    }
+    bool rootOutput = outputName.find("root") != std::string::npos;
+    if (!rootOutput && outputName.find("bin") == std::string::npos)
+    {
+      Error("Choose .bin or .root for your spectrum output file");
       return false;
     }
 
-    Success(Form("Done! Generated in %.1f seconds.", (double)(clock() - start) / CLOCKS_PER_SEC / NRTHREADS));
+    clock_t start = clock();
+
+    // Branch setup is serial: it may generate and register the daughter nuclei
+    Particle *nucleus = registeredParticles.at(initStatePDG);
+    vector<BetaBranchSpectrum> branches;
+    vector<bool> advanced;
+    for (DecayChannel *dc : nucleus->GetDecayChannels())
+    {
+      if (dc->GetModeName().find("Beta") == string::npos)
+        continue;
+
+      BetaBranchSpectrum branch;
+      branch.Q = dc->GetQValue();
+      branch.betaSign = (branch.Q < 0) ? 1 : -1;
+      branch.E0 = std::abs(branch.Q) - ((branch.betaSign == 1) ? 2 * utilities::EMASSC2 : 0.);
+      branch.intensity = dc->GetIntensity();
+      branch.parentExcitationEnergy = dc->GetParentExcitationEnergy();
+      branch.daughterExcitationEnergy = dc->GetDaughterExcitationEnergy();
+      if (branch.E0 <= 0.)
+        continue;
+
+      Particle *initState = GetNewParticle(initStatePDG);
+      initState->SetExcitationEnergy(branch.parentExcitationEnergy);
+      int recoilZ = initState->GetCharge() - branch.betaSign;
+      Particle *recoil = GetNewParticle(GetPDG(recoilZ, initState->GetNucleons()), recoilZ, initState->GetNucleons());
+      recoil->SetExcitationEnergy(branch.daughterExcitationEnergy);
+
+      branch.betaType = utilities::FindMatrixElement(initState, recoil, branch.mf, branch.mgt, branch.mixingRatio);
+      branch.j_i = utilities::GetJpi(initState->GetNucleons(), initState->GetCharge(), initState->GetExcitationEnergy());
+      branch.j_f = utilities::GetJpi(recoil->GetNucleons(), recoilZ, recoil->GetExcitationEnergy());
+      branch.b = correlation::CalculateFierz(branch.mf, branch.mgt, initState->GetCharge(), -branch.betaSign);
+      branch.parentMass = initState->GetMass();
+      branch.Z = (recoilZ - initState->GetCharge()) * recoilZ;
+      branch.A = recoil->GetNucleons();
+
+      branches.push_back(branch);
+      advanced.push_back(configOptions.betaDecay.FermiFunction == "Advanced" || dc->GetModeName() == "Beta_RC");
+      delete initState;
+      delete recoil;
+    }
+
+    if (branches.empty())
+    {
+      Warning("No beta branch found for " + initStateName);
+      return false;
+    }
+    Start(Form("Computing %d beta spectra...", (int)branches.size()));
+
+    // Spectra on the energy grid, one task per branch
+    double weakMagnetism = configOptions.nuclear.WeakMagnetism;
+    ThreadPool pool(std::max(1, std::min(NRTHREADS, (int)branches.size())));
+    for (size_t i = 0; i < branches.size(); ++i)
+    {
+      pool.enqueue([&branches, &advanced, i, stepSize, weakMagnetism]
+                   {
+        BetaBranchSpectrum &branch = branches[i];
+        vector<vector<double>> *dist = utilities::GenerateBetaSpectrum(branch.Z, branch.A, branch.E0, advanced[i], branch.betaType, branch.mf, branch.mgt, branch.mixingRatio, stepSize);
+        size_t n = dist->size();
+        int recoilZ = std::abs(branch.Z);
+
+        branch.energy.resize(n);
+        branch.shape.resize(n);
+        branch.distribution.resize(n);
+        branch.a.resize(n);
+        branch.A_beta.resize(n);
+        branch.radiative.resize(n);
+        vector<double> W(n);
+        for (size_t k = 0; k < n; ++k)
+        {
+          double E = (*dist)[k][0] + utilities::EMASSC2;
+          branch.energy[k] = (*dist)[k][0];
+          branch.shape[k] = (*dist)[k][1];
+          branch.distribution[k] = branch.shape[k] * (1 + branch.b * utilities::EMASSC2 / E + (-branch.betaSign) * 4. / 3. * E / branch.parentMass * weakMagnetism);
+          branch.a[k] = correlation::CalculateBetaNeutrinoAsymmetry(branch.mf, branch.mgt, E, recoilZ, -branch.betaSign);
+          branch.A_beta[k] = (branch.j_i > 0) ? correlation::CalculateBetaAssymetry(branch.mf, branch.mgt, branch.j_i, branch.j_f, -branch.betaSign, recoilZ, E) : 0.;
+          W[k] = E / utilities::EMASSC2;
+        }
+        delete dist;
+
+        utilities::BetaSpectrumContext ctx = utilities::BuildBetaSpectrumContext(branch.Z, branch.A);
+        utilities::RadiativeCorrection(W.data(), branch.radiative.data(), n, branch.E0 / utilities::EMASSC2 + 1., ctx.Z, ctx.R, 1.27, 4.706); });
+    }
+    pool.wait_all();
+
+    if (rootOutput)
+    {
+      outputFile = new TFile(outputName.c_str(), "RECREATE");
+      if (!outputFile->IsOpen())
+      {
+        Error("Could not open output file " + outputName);
+        return false;
+      }
+
+      BetaBranchSpectrum info;
+      int index;
+      TTree *branchTree = new TTree("BetaBranches", "Beta branches of the initial nucleus");
+      branchTree->Branch("index", &index);
+      branchTree->Branch("Q", &info.Q);
+      branchTree->Branch("E0", &info.E0);
+      branchTree->Branch("intensity", &info.intensity);
+      branchTree->Branch("parent_excitation_energy", &info.parentExcitationEnergy);
+      branchTree->Branch("daughter_excitation_energy", &info.daughterExcitationEnergy);
+      branchTree->Branch("beta_sign", &info.betaSign);
+      branchTree->Branch("beta_type", &info.betaType);
+      branchTree->Branch("mf", &info.mf);
+      branchTree->Branch("mgt", &info.mgt);
+      branchTree->Branch("mixing_ratio", &info.mixingRatio);
+      branchTree->Branch("j_i", &info.j_i);
+      branchTree->Branch("j_f", &info.j_f);
+      branchTree->Branch("b", &info.b);
+
+      for (size_t i = 0; i < branches.size(); ++i)
+      {
+        const BetaBranchSpectrum &branch = branches[i];
+        index = i;
+        info.Q = branch.Q;
+        info.E0 = branch.E0;
+        info.intensity = branch.intensity;
+        info.parentExcitationEnergy = branch.parentExcitationEnergy;
+        info.daughterExcitationEnergy = branch.daughterExcitationEnergy;
+        info.betaSign = branch.betaSign;
+        info.betaType = branch.betaType;
+        info.mf = branch.mf;
+        info.mgt = branch.mgt;
+        info.mixingRatio = branch.mixingRatio;
+        info.j_i = branch.j_i;
+        info.j_f = branch.j_f;
+        info.b = branch.b;
+        branchTree->Fill();
+
+        double energy, shape, distribution, a, A, radiative;
+        TTree *spectrumTree = new TTree(Form("BetaSpectrum_%d", (int)i), Form("Beta spectrum of branch %d (Q = %.1f keV)", (int)i, branch.Q));
+        spectrumTree->Branch("energy", &energy);
+        spectrumTree->Branch("shape", &shape);
+        spectrumTree->Branch("distribution", &distribution);
+        spectrumTree->Branch("a", &a);
+        spectrumTree->Branch("A", &A);
+        spectrumTree->Branch("radiative", &radiative);
+        for (size_t k = 0; k < branch.energy.size(); ++k)
+        {
+          energy = branch.energy[k];
+          shape = branch.shape[k];
+          distribution = branch.distribution[k];
+          a = branch.a[k];
+          A = branch.A_beta[k];
+          radiative = branch.radiative[k];
+          spectrumTree->Fill();
+        }
+        spectrumTree->Write("", TObject::kOverwrite);
+      }
+      branchTree->Write("", TObject::kOverwrite);
+
+      WriteDecayData(configOptions.envOptions.Radiationdata + "/z" + std::to_string(nucleus->GetCharge()) + ".a" + std::to_string(nucleus->GetNucleons()), "Radiation");
+      WriteConfigData(ConfigFilename);
+      outputFile->Close();
+    }
+    else
+    {
+      // Binary table, native endianness:
+      // "CRADLESP" | int32 version | int32 number of branches
+      // per branch: int32 beta_sign, beta_type | 11 doubles Q, E0, intensity, parent_excitation_energy,
+      // daughter_excitation_energy, mf, mgt, mixing_ratio, j_i, j_f, b | int64 number of points |
+      // columns energy, shape, distribution, a, A, radiative (number of points doubles each)
+      std::ofstream fileStream(outputName.c_str(), std::ios::binary);
+      if (!fileStream.is_open())
+      {
+        Error("Could not open output file " + outputName);
+        return false;
+      }
+      const int32_t version = 1;
+      const int32_t nrBranches = branches.size();
+      fileStream.write("CRADLESP", 8);
+      fileStream.write(reinterpret_cast<const char *>(&version), sizeof(version));
+      fileStream.write(reinterpret_cast<const char *>(&nrBranches), sizeof(nrBranches));
+      for (const BetaBranchSpectrum &branch : branches)
+      {
+        const int32_t types[2] = {branch.betaSign, branch.betaType};
+        const double header[11] = {branch.Q, branch.E0, branch.intensity, branch.parentExcitationEnergy, branch.daughterExcitationEnergy,
+                                   branch.mf, branch.mgt, branch.mixingRatio, branch.j_i, branch.j_f, branch.b};
+        const int64_t nrPoints = branch.energy.size();
+        fileStream.write(reinterpret_cast<const char *>(types), sizeof(types));
+        fileStream.write(reinterpret_cast<const char *>(header), sizeof(header));
+        fileStream.write(reinterpret_cast<const char *>(&nrPoints), sizeof(nrPoints));
+        for (const vector<double> *column : {&branch.energy, &branch.shape, &branch.distribution, &branch.a, &branch.A_beta, &branch.radiative})
+          fileStream.write(reinterpret_cast<const char *>(column->data()), nrPoints * sizeof(double));
+      }
+      fileStream.close();
+    }
+
+    Success(Form("Done! Computed in %.1f seconds.", (double)(clock() - start) / CLOCKS_PER_SEC / NRTHREADS));
     return true;
   }
 
@@ -7,6 +7,8 @@
 
 #include <string>
 #include <sstream>
+#include <map>
+#include <algorithm>
 
 
 namespace CRADLE {
@@ -143,6 +145,109 @@ void DecayMode::TwoBodyDecay(ublas::vector<double>& velocity, Particle* finalSta
   TwoBodyDecay(velocity, finalState1, finalState2, Q, dir);
 }
 
+BetaDecayBatch::BetaDecayBatch(const std::vector<std::vector<double> >& dist, double e0, double m1, double m2, double m3, double a_0, double a_Coulomb, double b_Fierz):
+  E0(e0), massLepton(m1), massNeutrino(m2), massRecoil(m3), a0(a_0), aCoulomb(a_Coulomb), b(b_Fierz) {
+  // Same piecewise constant density as utilities::RandomFromDistribution
+  begin = dist.front()[0];
+  end = dist.back()[0];
+  cdf.assign(dist.size() + 1, 0.);
+  for (std::size_t k = 0; k < dist.size(); ++k)
+    cdf[k + 1] = cdf[k] + std::max(dist[k][1], 0.);
+  for (std::size_t k = 1; k < cdf.size(); ++k)
+    cdf[k] /= cdf.back();
+}
+
+void BetaDecayBatch::Generate(std::size_t n, std::mt19937_64& generator) {
+  for (std::vector<double>* v : {&leptonE, &leptonPx, &leptonPy, &leptonPz, &neutrinoE, &neutrinoPx, &neutrinoPy, &neutrinoPz, &recoilE, &recoilPx, &recoilPy, &recoilPz})
+    v->resize(n);
+  cursor = 0;
+
+  // Uniform numbers first, the kinematics loops below only do arithmetic
+  std::uniform_real_distribution<double> uniform(0., 1.);
+  std::vector<double> rEnergy(n), rNeutrinoZ(n), rNeutrinoPhi(n), rCosTheta(n), rPhi(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    rEnergy[i] = uniform(generator);
+    rNeutrinoZ[i] = uniform(generator);
+    rNeutrinoPhi[i] = uniform(generator);
+    rCosTheta[i] = uniform(generator);
+    rPhi[i] = uniform(generator);
+  }
+
+  // Lepton total energy from the inverse CDF
+  std::size_t nBins = cdf.size() - 1;
+  for (std::size_t i = 0; i < n; ++i) {
+    std::size_t k = std::upper_bound(cdf.begin() + 1, cdf.end() - 1, rEnergy[i]) - cdf.begin() - 1;
+    double width = cdf[k + 1] - cdf[k];
+    double fraction = (width > 0.) ? (rEnergy[i] - cdf[k]) / width : 0.;
+    leptonE[i] = begin + (k + fraction) / nBins * (end - begin) + massLepton;
+  }
+
+  const double a2 = massNeutrino * massNeutrino;
+  const double b2 = massRecoil * massRecoil;
+  for (std::size_t i = 0; i < n; ++i) {
+    double W = leptonE[i];
+    double p = std::sqrt(W * W - massLepton * massLepton);
+
+    // Isotropic neutrino direction
+    double nz = 2. * rNeutrinoZ[i] - 1.;
+    double nr = std::sqrt(1. - nz * nz);
+    double nx = nr * std::cos(2. * M_PI * rNeutrinoPhi[i]);
+    double ny = nr * std::sin(2. * M_PI * rNeutrinoPhi[i]);
+
+    // Angle to the neutrino from W(theta) = alpha + beta cos(theta)
+    double alpha = 1. + b * massLepton / W;
+    double beta = (a0 + aCoulomb * massLepton / p) * p / W;
+    if (std::abs(beta) > 1.) {
+      Error("Beta value " + std::to_string(beta) + " is out of physical range.");
+    }
+    double kappa = beta / alpha;
+    if (std::abs(kappa) > 1.) {
+      Error("Kappa value " + std::to_string(kappa) + " is out of physical range.");
+    }
+    double cosTheta = (std::abs(kappa) < 1e-10) ? 2. * rCosTheta[i] - 1. : (-1. + std::sqrt((1. - kappa) * (1. - kappa) + 4. * kappa * rCosTheta[i])) / kappa;
+    double sinTheta = std::sqrt(std::max(0., 1. - cosTheta * cosTheta));
+
+    // Orthonormal basis (u, v) perpendicular to the neutrino direction
+    double hx = (std::abs(nz) < 0.9) ? 0. : 1.;
+    double hz = 1. - hx;
+    double ux = hz * ny;
+    double uy = hx * nz - hz * nx;
+    double uz = -hx * ny;
+    double uNorm = std::sqrt(ux * ux + uy * uy + uz * uz);
+    ux /= uNorm;
+    uy /= uNorm;
+    uz /= uNorm;
+    double vx = ny * uz - nz * uy;
+    double vy = nz * ux - nx * uz;
+    double vz = nx * uy - ny * ux;
+
+    double cosPhi = std::cos(2. * M_PI * rPhi[i]);
+    double sinPhi = std::sin(2. * M_PI * rPhi[i]);
+    leptonPx[i] = p * (cosTheta * nx + sinTheta * (cosPhi * ux + sinPhi * vx));
+    leptonPy[i] = p * (cosTheta * ny + sinTheta * (cosPhi * uy + sinPhi * vy));
+    leptonPz[i] = p * (cosTheta * nz + sinTheta * (cosPhi * uz + sinPhi * vz));
+
+    // Neutrino momentum, same solution as ThreeBodyDecay
+    double c = p;
+    double d = E0 + massLepton + massNeutrino + massRecoil - W;
+    double e = cosTheta;
+    double first = 1. / 2. / (c * c * e * e - d * d);
+    double second = a2 * a2 * d * d - 2 * a2 * b2 * d * d + 4. * a2 * c * c * d * d * e * e - 2. * a2 * c * c * d * d - 2. * a2 * d * d * d * d + b2 * b2 * d * d + 2 * b2 * c * c * d * d - 2. * b2 * d * d * d * d + c * c * c * c * d * d - 2. * c * c * d * d * d * d + d * d * d * d * d * d;
+    double third = a2 * c * e - b2 * c * e - c * c * c * e + c * d * d * e;
+    double q = first * (-std::sqrt(second) + third);
+
+    neutrinoPx[i] = q * nx;
+    neutrinoPy[i] = q * ny;
+    neutrinoPz[i] = q * nz;
+    neutrinoE[i] = std::sqrt(a2 + q * q);
+
+    recoilPx[i] = -(leptonPx[i] + neutrinoPx[i]);
+    recoilPy[i] = -(leptonPy[i] + neutrinoPy[i]);
+    recoilPz[i] = -(leptonPz[i] + neutrinoPz[i]);
+    recoilE[i] = std::sqrt(b2 + recoilPx[i] * recoilPx[i] + recoilPy[i] * recoilPy[i] + recoilPz[i] * recoilPz[i]);
+  }
+}
+
 std::vector<Particle*> BetaRadiative::Decay(Particle* initState, double Q, double daughterExEn) {
   // Beta decay using 4-body decay radiative correction
   std::vector<Particle*> finalStates;
@@ -220,7 +325,9 @@ std::vector<Particle*> BetaRadiative::Decay(Particle* initState, double Q, doubl
 
   // Random for Hard vs Soft/Virtual Bremsstrahlung
   std::uniform_real_distribution<double> distribution(0., 1.);
-  double ph = distribution(dm.generator);
+  // Per-thread engine, the decays of the worker threads run concurrently
+  thread_local std::mt19937 radiativeGenerator(rand());
+  double ph = distribution(radiativeGenerator);
   if (ph < PH)
   {
     if (dm.configOptions.general.Verbosity >= 2)
@@ -242,9 +349,9 @@ std::vector<Particle*> BetaRadiative::Decay(Particle* initState, double Q, doubl
 
     while (W_H > W_point_H)
     {
-      W_H = distribution_wHmax(dm.generator);
+      W_H = distribution_wHmax(radiativeGenerator);
 
-      double U[8] = {distribution(dm.generator), distribution(dm.generator), distribution(dm.generator), distribution(dm.generator), distribution(dm.generator), distribution(dm.generator), distribution(dm.generator), distribution(dm.generator)};
+      double U[8] = {distribution(radiativeGenerator), distribution(radiativeGenerator), distribution(radiativeGenerator), distribution(radiativeGenerator), distribution(radiativeGenerator), distribution(radiativeGenerator), distribution(radiativeGenerator), distribution(radiativeGenerator)};
       E2 = 1. + (radiativecorrections::delta(InitialMass, RecoilMass, BetaSign) - 1.) * U[0];
       double E10 = radiativecorrections::delta(InitialMass, RecoilMass, BetaSign) - E2;
       double omega = dm.configOptions.betaDecay.Cs * E10;
@@ -336,13 +443,13 @@ std::vector<Particle*> BetaRadiative::Decay(Particle* initState, double Q, doubl
 
     while (W_VS > W_point_VS)
     {
-      W_VS = distribution_wVSmax(dm.generator);
+      W_VS = distribution_wVSmax(radiativeGenerator);
       
-      U[0] = distribution(dm.generator);
-      U[1] = distribution(dm.generator);
-      U[2] = distribution(dm.generator);
-      U[3] = distribution(dm.generator);
-      U[4] = distribution(dm.generator);
+      U[0] = distribution(radiativeGenerator);
+      U[1] = distribution(radiativeGenerator);
+      U[2] = distribution(radiativeGenerator);
+      U[3] = distribution(radiativeGenerator);
+      U[4] = distribution(radiativeGenerator);
 
       E2 = 1. + (radiativecorrections::delta(InitialMass, RecoilMass, BetaSign) - 1.) * U[0];
       COS_NEUTRINO = 2. * U[1] - 1.;
@@ -469,24 +576,46 @@ std::vector<Particle*> Beta::Decay(Particle* initState, double Q, double daughte
     dm.SetChannelMgt(ChannelName, mgt);
   }
   
-  // Angle correlation
-  double ChargedLepton_Energy = utilities::RandomFromDistribution(*dist, dist_max) + utilities::EMASSC2;
-  ublas::vector<double> ChargedLepton_FourMomentum(4);
-  double ChargedLepton_Momentum = std::sqrt(ChargedLepton_Energy*ChargedLepton_Energy-std::pow(utilities::EMASSC2, 2.));
-  ublas::vector<double> NeutralLepton_Dir;
-  ublas::vector<double> ChargedLepton_Dir;
-  
+  ublas::vector<double> velocity = -initState->GetVelocity();
+
   if (dm.configOptions.nuclear.Alignment == 0 && dm.configOptions.nuclear.PolarisationMag == 0)
   {
     ///// IF THE NUCLEUS IS NOT POLARISED ////
-    NeutralLepton_Dir = utilities::RandomDirection();
-    double a = correlation::CalculateBetaNeutrinoAsymmetry(mf, mgt, ChargedLepton_Energy, Recoil_Z, -BetaSign);
-    double b = correlation::CalculateFierz(mf, mgt, Recoil_Z, -BetaSign);
-    ChargedLepton_Dir = utilities::GetParticleDirection(NeutralLepton_Dir, 1 + b * utilities::EMASSC2/ChargedLepton_Energy, a * ChargedLepton_Momentum / ChargedLepton_Energy);
+    // Kinematics generated by batches of the channel in the rest frame of the parent, then boosted
+    thread_local std::map<std::string, BetaDecayBatch> batches;
+    thread_local std::mt19937_64 batchGenerator(rand());
+    std::map<std::string, BetaDecayBatch>::iterator it = batches.find(ChannelName);
+    if (it == batches.end())
+    {
+      double a0, aCoulomb;
+      correlation::CalculateBetaNeutrinoAsymmetryTerms(mf, mgt, -BetaSign, a0, aCoulomb);
+      double b = correlation::CalculateFierz(mf, mgt, Recoil_Z, -BetaSign);
+      it = batches.emplace(ChannelName, BetaDecayBatch(*dist, E0, ChargedLepton->GetMass(), NeutralLepton->GetMass(), Recoil->GetMass(), a0, aCoulomb * utilities::FINESTRUCTURE * Recoil_Z, b)).first;
+    }
+    BetaDecayBatch &batch = it->second;
+    if (batch.Empty())
+      batch.Generate(utilities::BATCH_SIZE, batchGenerator);
+    std::size_t i = batch.Next();
+
+    ublas::vector<double> momentum(4);
+    bool atRest = utilities::GetNorm(velocity) == 0.;
+    momentum(0) = batch.leptonE[i]; momentum(1) = batch.leptonPx[i]; momentum(2) = batch.leptonPy[i]; momentum(3) = batch.leptonPz[i];
+    ChargedLepton->SetMomentum(atRest ? momentum : utilities::LorentzBoost(velocity, momentum));
+    momentum(0) = batch.neutrinoE[i]; momentum(1) = batch.neutrinoPx[i]; momentum(2) = batch.neutrinoPy[i]; momentum(3) = batch.neutrinoPz[i];
+    NeutralLepton->SetMomentum(atRest ? momentum : utilities::LorentzBoost(velocity, momentum));
+    momentum(0) = batch.recoilE[i]; momentum(1) = batch.recoilPx[i]; momentum(2) = batch.recoilPy[i]; momentum(3) = batch.recoilPz[i];
+    Recoil->SetMomentum(atRest ? momentum : utilities::LorentzBoost(velocity, momentum));
   }
   else
   {
     ///// IF THE NUCLEUS IS POLARISED ////
+    // Angle correlation
+    double ChargedLepton_Energy = utilities::RandomFromDistribution(*dist, dist_max) + utilities::EMASSC2;
+    ublas::vector<double> ChargedLepton_FourMomentum(4);
+    double ChargedLepton_Momentum = std::sqrt(ChargedLepton_Energy*ChargedLepton_Energy-std::pow(utilities::EMASSC2, 2.));
+    ublas::vector<double> NeutralLepton_Dir;
+    ublas::vector<double> ChargedLepton_Dir;
+
     double b = correlation::CalculateFierz(mf, mgt, Recoil_Z, -BetaSign);
     double align = dm.configOptions.nuclear.Alignment;
     ublas::vector<double> polDir(3);
@@ -522,29 +651,20 @@ std::vector<Particle*> Beta::Decay(Particle* initState, double Q, double daughte
       Info(Form("Correlation Coefficients: a = %.3f, b = %.3f, c = %.3f, A = %.3f, B = %.3f, D = %.3f", a, b, c, A, B, D), 3);
     }
 
-    double F_max = correlation::AnalyticalMaximumAngCorrFactor(a, b, c, A, B, D, ChargedLepton_Energy);
-    double F_point = 0;
-    std::uniform_real_distribution<double> distribution_F(0.0, F_max);
-    double F = F_max;
-    while (F > F_point)
-    {
-      F = distribution_F(dm.generator);
-      ChargedLepton_Dir = utilities::RandomDirection();
-      NeutralLepton_Dir = utilities::RandomDirection();
-      F_point = correlation::CalculateAngularCorrelationFactor(a, b, c, A, B, D, ChargedLepton_Energy, ChargedLepton_Dir, NeutralLepton_Dir, polDir);
-    }
-  }
+    // electron from its marginal distribution, then neutrino from the conditional one (no rejection)
+    thread_local std::mt19937 directionGenerator(rand());
+    correlation::SampleLeptonDirections(a, b, c, A, B, D, ChargedLepton_Energy, polDir, directionGenerator, ChargedLepton_Dir, NeutralLepton_Dir);
 
-  // Setting Charged Lepton 4-momentum
-  ChargedLepton_FourMomentum(0) = ChargedLepton_Energy;
-  ChargedLepton_FourMomentum(1) = ChargedLepton_Momentum*ChargedLepton_Dir[0];
-  ChargedLepton_FourMomentum(2) = ChargedLepton_Momentum*ChargedLepton_Dir[1];
-  ChargedLepton_FourMomentum(3) = ChargedLepton_Momentum*ChargedLepton_Dir[2];
-  ChargedLepton->SetMomentum(ChargedLepton_FourMomentum);
+    // Setting Charged Lepton 4-momentum
+    ChargedLepton_FourMomentum(0) = ChargedLepton_Energy;
+    ChargedLepton_FourMomentum(1) = ChargedLepton_Momentum*ChargedLepton_Dir[0];
+    ChargedLepton_FourMomentum(2) = ChargedLepton_Momentum*ChargedLepton_Dir[1];
+    ChargedLepton_FourMomentum(3) = ChargedLepton_Momentum*ChargedLepton_Dir[2];
+    ChargedLepton->SetMomentum(ChargedLepton_FourMomentum);
 
-  // 3-body decay kinematics
-  ublas::vector<double> velocity = -initState->GetVelocity();
-  ThreeBodyDecay(velocity, ChargedLepton, NeutralLepton, Recoil, NeutralLepton_Dir, E0);
+    // 3-body decay kinematics
+    ThreeBodyDecay(velocity, ChargedLepton, NeutralLepton, Recoil, NeutralLepton_Dir, E0);
+  }
 
   // Adding final states to vector
   finalStates.push_back(Recoil);
@@ -572,12 +692,25 @@ std::vector<Particle*> ConversionElectron::Decay(Particle* initState, double Q,
   return finalStates;
 }
 
+// Width of the decaying level, from the decay plan when the particle follows it
+static double LevelWidth(Particle* p)
+{
+  int node = p->GetPlanNode();
+  if (node < 0)
+    return p->GetLevelWidth();
+  return DecayManager::GetInstance().GetDecayPlan().GetNode(node).levelWidth;
+}
+
 std::vector<Particle*> Proton::Decay(Particle* initState, double Q, double daughterExEn) {
   std::vector<Particle*> finalStates;
   DecayManager& dm = DecayManager::GetInstance();
   //// nuclear level width
-  if (dm.configOptions.decay.NuclearLevelWidth) 
-    Q = utilities::BreitWigner(Q, initState->GetLifetime());
+  if (dm.configOptions.decay.NuclearLevelWidth)
+  {
+    // Per-thread engine, the decays of the worker threads run concurrently
+    thread_local std::mt19937_64 levelWidthGenerator(rand());
+    Q = utilities::BreitWigner(Q, LevelWidth(initState), levelWidthGenerator);
+  }
   
   int daughter_PDG = GetPDG(initState->GetCharge()-1, initState->GetNucleons()-1);
   Particle* Recoil = dm.GetNewParticle(daughter_PDG, initState->GetCharge()-1, initState->GetNucleons()-1);
@@ -597,8 +730,12 @@ std::vector<Particle*> Alpha::Decay(Particle* initState, double Q, double daught
   std::vector<Particle*> finalStates;
   DecayManager& dm = DecayManager::GetInstance();
   //// nuclear level width
-  if (dm.configOptions.decay.NuclearLevelWidth) 
-    Q = utilities::BreitWigner(Q, initState->GetLifetime());
+  if (dm.configOptions.decay.NuclearLevelWidth)
+  {
+    // Per-thread engine, the decays of the worker threads run concurrently
+    thread_local std::mt19937_64 levelWidthGenerator(rand());
+    Q = utilities::BreitWigner(Q, LevelWidth(initState), levelWidthGenerator);
+  }
 
   int daughter_PDG = GetPDG(initState->GetCharge()-2, initState->GetNucleons()-4);
   Particle* Recoil = dm.GetNewParticle(daughter_PDG, initState->GetCharge()-2, initState->GetNucleons()-4);
@@ -622,62 +759,29 @@ std::vector<Particle*> Gamma::Decay(Particle* initState, double Q, double daught
   Particle* Recoil = DecayManager::GetInstance().GetNewParticle(initState->GetPDG());
   Particle* gamma = DecayManager::GetInstance().GetNewParticle(22);
   Recoil->SetExcitationEnergy(daughterExEn);
-  int Recoil_Z = Recoil->GetCharge();
-  int Recoil_A = Recoil_Z + Recoil->GetNeutrons();
 
+  const GammaCascade* cascade = nullptr;
   if (initState->GetLastGamma() != nullptr && dm.configOptions.decay.GammaGammaCorrelation)
   {
+    // Gamma - Gamma correlation (E_i --> E --> E_f), tabulated when the level scheme was loaded
+    const GammaCascadeTable* cascadeTable = dm.GetGammaCascadeTable(initState->GetPDG());
+    if (cascadeTable != nullptr)
+      cascade = cascadeTable->GetCascade(initState->GetExcitationEnergy() + initState->GetLastGamma()->GetKinEnergy(), initState->GetExcitationEnergy(), daughterExEn);
+  }
 
-    std::ostringstream oss;
-    oss << "GammaGamma:" << "Z" << Recoil_Z << "A" << Recoil_A << "Ei" << initState->GetExcitationEnergy() + initState->GetLastGamma()->GetKinEnergy() << "Em" << initState->GetExcitationEnergy() << "Ef" << Recoil->GetExcitationEnergy();
-    // std::cout << oss.str() << std::endl;
-    // Gamma - Gamma correlation (E_i --> E --> E_f)
+  if (cascade != nullptr)
+  {
     Particle *gamma_1 = initState->GetLastGamma();
     ublas::vector<double> gamma_1_dir = gamma_1->Get3Momentum();
+    const std::vector<double> &ak = cascade->ak;
 
-    //
-    std::vector<double> ak;
-    double W_max;
-    try
-    {
-      ak = dm.GetChannelDistribution(oss.str())->at(0);
-      W_max = dm.GetChannelDistributionMax(oss.str());  
-    }
-    catch (const std::invalid_argument &e)
-    {
-      // Calculation
-      double j_i = utilities::GetJpi(initState->GetCharge() + initState->GetNeutrons(), initState->GetCharge(), initState->GetExcitationEnergy() + gamma_1->GetKinEnergy());
-      double j = utilities::GetJpi(initState->GetCharge() + initState->GetNeutrons(), initState->GetCharge(), initState->GetExcitationEnergy());
-      double j_f = utilities::GetJpi(Recoil->GetCharge() + Recoil->GetNeutrons(), Recoil->GetCharge(), Recoil->GetExcitationEnergy());
-    
-      double delta_1 = initState->GetMixingRatio(initState->GetExcitationEnergy() + gamma_1->GetKinEnergy(), initState->GetExcitationEnergy());
-      std::pair<int, int> l1 = initState->GetMultipolarities(initState->GetExcitationEnergy() + gamma_1->GetKinEnergy(), initState->GetExcitationEnergy());
-      double delta_2 = Recoil->GetMixingRatio(initState->GetExcitationEnergy(), daughterExEn);
-      std::pair<int, int> l2 = Recoil->GetMultipolarities(initState->GetExcitationEnergy(), daughterExEn);
-
-      ak = correlation::CaluclateGammaCoefficient_a(std::abs(j_i), std::abs(j), std::abs(j_f), l1, delta_1, l2, delta_2);
-      W_max = correlation::MaxAnalyticalGammaCorrelation(ak);
-
-      std::vector<std::vector<double>>* dist = new std::vector<std::vector<double>>();
-      dist->push_back(ak);
-      dm.RegisterChannelPropreties(oss.str(), dist, W_max, j_i, j_f, j); 
-    }
-
-    if (dm.configOptions.general.Verbosity >= 2)
+    if (dm.configOptions.general.Verbosity >= 2 && ak.size() >= 3)
       Info(Form("Gamma-Gamma correlation coefficients: a0 = %.4f, a2 = %.4f, a4 = %.4f", ak[0], ak[1], ak[2]), 1);
-    
+
     ublas::vector<double> gamma_2_dir(3);
-    double W = W_max;
-    double W_point = 0;
-    std::uniform_real_distribution<double> distribution(0.0, W_max);
-    std::uniform_real_distribution<double> theta_dist(0, M_PI);
-    double theta = 0;
-    while (W_point < W)
-    {
-      W = distribution(dm.generator);    
-      theta = theta_dist(dm.generator);
-      W_point = correlation::GammaGammaW(cos(theta), ak);
-    }
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    thread_local std::mt19937 cascadeGenerator(rand());
+    double theta = std::acos(correlation::RandomGammaGammaCosTheta(ak, cascade->cdfTable, distribution(cascadeGenerator)));
 
     gamma_1_dir = utilities::NormaliseVector(gamma_1_dir);
     ublas::vector<double> perp = utilities::CrossProduct(gamma_1_dir, utilities::RandomDirection());
@@ -0,0 +1,128 @@
+#include "CRADLE/DecayPlan.hh"
+#include "CRADLE/DecayChannel.hh"
+
+#include <algorithm>
+#include <cmath>
+
+namespace CRADLE {
+
+  void DecayPlan::Clear() {
+    nodes.clear();
+    nodesByPDG.clear();
+    biased = false;
+    forced = false;
+    branchingRatio = 1.;
+  }
+
+  int DecayPlan::AddNode(int pdg, double excitationEnergy, const std::vector<DecayChannel*>& channels) {
+    DecayPlanNode node;
+    node.pdg = pdg;
+    node.excitationEnergy = excitationEnergy;
+    node.lifetime = channels.empty() ? 1.e46 : channels[0]->GetLifetime();
+    node.levelWidth = channels.empty() ? 0. : channels[0]->GetLevelWidth();
+    node.channels = channels;
+    node.children.assign(channels.size(), -1);
+    node.weights.assign(channels.size(), 1.);
+
+    for (DecayChannel* dc : channels)
+      node.intensities.push_back(dc->GetIntensity());
+    BuildAliasTable(node, node.intensities);
+
+    int index = nodes.size();
+    nodes.push_back(node);
+    nodesByPDG.emplace(pdg, index);
+    return index;
+  }
+
+  void DecayPlan::SetBias(int node, const std::vector<double>& factors) {
+    DecayPlanNode& n = nodes[node];
+    double totalIntensity = 0.;
+    double totalBiasedIntensity = 0.;
+    std::vector<double> intensities(n.channels.size());
+    for (std::size_t i = 0; i < n.channels.size(); ++i) {
+      intensities[i] = n.intensities[i] * factors[i];
+      totalIntensity += n.intensities[i];
+      totalBiasedIntensity += intensities[i];
+    }
+    if (totalIntensity <= 0. || totalBiasedIntensity <= 0.)
+      return;
+
+    // Channels are sampled from the biased intensities; the weight of a channel brings
+    // its contribution back to the natural branching ratio
+    for (std::size_t i = 0; i < n.channels.size(); ++i)
+      n.weights[i] = totalBiasedIntensity / (totalIntensity * factors[i]);
+    BuildAliasTable(n, intensities);
+    biased = true;
+  }
+
+  double DecayPlan::ForceChannels(int node, const std::vector<char>& allowed) {
+    // Only the allowed channels are sampled, in their natural proportions; the branching
+    // ratio of the level into them is returned and added to the one of the path
+    DecayPlanNode& n = nodes[node];
+    double totalIntensity = 0.;
+    double allowedIntensity = 0.;
+    for (std::size_t i = 0; i < n.channels.size(); ++i) {
+      totalIntensity += n.intensities[i];
+      if (allowed[i])
+        allowedIntensity += n.intensities[i];
+      else
+        n.intensities[i] = 0.;
+    }
+    if (totalIntensity <= 0. || allowedIntensity <= 0.)
+      return 0.;
+
+    BuildAliasTable(n, n.intensities);
+    forced = true;
+    branchingRatio *= allowedIntensity / totalIntensity;
+    return allowedIntensity / totalIntensity;
+  }
+
+  void DecayPlan::BuildAliasTable(DecayPlanNode& node, const std::vector<double>& intensities) {
+    // Walker alias table (Vose's construction)
+    std::size_t n = intensities.size();
+    double totalIntensity = 0.;
+    for (double intensity : intensities)
+      totalIntensity += intensity;
+
+    node.aliasProbability.assign(n, 1.);
+    node.aliasIndex.resize(n);
+    std::vector<double> scaled(n);
+    std::vector<int> small, large;
+    for (std::size_t i = 0; i < n; ++i) {
+      node.aliasIndex[i] = i;
+      scaled[i] = (totalIntensity > 0.) ? intensities[i] * n / totalIntensity : 1.;
+      if (scaled[i] < 1.)
+        small.push_back(i);
+      else
+        large.push_back(i);
+    }
+    while (!small.empty() && !large.empty()) {
+      int s = small.back();
+      small.pop_back();
+      int l = large.back();
+      node.aliasProbability[s] = scaled[s];
+      node.aliasIndex[s] = l;
+      scaled[l] -= 1. - scaled[s];
+      if (scaled[l] < 1.) {
+        large.pop_back();
+        small.push_back(l);
+      }
+    }
+  }
+
+  int DecayPlan::FindNode(int pdg, double excitationEnergy) const {
+    auto range = nodesByPDG.equal_range(pdg);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (std::abs(nodes[it->second].excitationEnergy - excitationEnergy) < LevelTolerance)
+        return it->second;
+    }
+    return -1;
+  }
+
+  int DecayPlan::SampleChannel(int node, double r) const {
+    const DecayPlanNode& n = nodes[node];
+    double u = r * n.channels.size();
+    std::size_t i = std::min<std::size_t>(u, n.channels.size() - 1);
+    return (u - i < n.aliasProbability[i]) ? i : n.aliasIndex[i];
+  }
+}//End of CRADLE namespace
@@ -0,0 +1,126 @@
+#include "CRADLE/GammaCascade.hh"
+#include "CRADLE/Utilities.hh"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <cmath>
+
+namespace CRADLE {
+
+  void GammaCascadeTable::AddLevel(double energy, double spin) {
+    levelEnergies.push_back(energy);
+    levelSpins.push_back(spin);
+  }
+
+  void GammaCascadeTable::AddTransition(double parentEnergy, double daughterEnergy, std::pair<int, int> multipolarities, double mixingRatio) {
+    transitions.push_back({parentEnergy, daughterEnergy, multipolarities, mixingRatio});
+  }
+
+  void GammaCascadeTable::Build() {
+    // Sort levels by energy to allow binary search
+    std::vector<std::size_t> order(levelEnergies.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) { return levelEnergies[a] < levelEnergies[b]; });
+
+    std::vector<double> energies, spins;
+    for (std::size_t i : order) {
+      energies.push_back(levelEnergies[i]);
+      spins.push_back(levelSpins[i]);
+    }
+    levelEnergies = energies;
+    levelSpins = spins;
+
+    int nLevels = levelEnergies.size();
+
+    // Resolve transitions to level indices and fill the per-level lists
+    std::vector<int> from(transitions.size()), to(transitions.size());
+    inOffset.assign(nLevels + 1, 0);
+    outOffset.assign(nLevels + 1, 0);
+    for (std::size_t t = 0; t < transitions.size(); ++t) {
+      from[t] = FindLevel(transitions[t].parentEnergy);
+      to[t] = FindLevel(transitions[t].daughterEnergy);
+      if (from[t] < 0 || to[t] < 0)
+        continue;
+      ++outOffset[from[t] + 1];
+      ++inOffset[to[t] + 1];
+    }
+    for (int m = 0; m < nLevels; ++m) {
+      inOffset[m + 1] += inOffset[m];
+      outOffset[m + 1] += outOffset[m];
+    }
+
+    inLevel.assign(inOffset[nLevels], 0);
+    outLevel.assign(outOffset[nLevels], 0);
+    std::vector<int> inTransition(inOffset[nLevels]), outTransition(outOffset[nLevels]);
+    std::vector<int> inFill(inOffset.begin(), inOffset.end() - 1), outFill(outOffset.begin(), outOffset.end() - 1);
+    for (std::size_t t = 0; t < transitions.size(); ++t) {
+      if (from[t] < 0 || to[t] < 0)
+        continue;
+      inLevel[inFill[to[t]]] = from[t];
+      inTransition[inFill[to[t]]++] = t;
+      outLevel[outFill[from[t]]] = to[t];
+      outTransition[outFill[from[t]]++] = t;
+    }
+
+    // One cascade for every (feeding, depopulating) pair of each level
+    cascadeOffset.assign(nLevels + 1, 0);
+    for (int m = 0; m < nLevels; ++m)
+      cascadeOffset[m + 1] = cascadeOffset[m] + (inOffset[m + 1] - inOffset[m]) * (outOffset[m + 1] - outOffset[m]);
+
+    cascades.assign(cascadeOffset[nLevels], GammaCascade());
+    for (int m = 0; m < nLevels; ++m) {
+      int nOut = outOffset[m + 1] - outOffset[m];
+      for (int ii = inOffset[m]; ii < inOffset[m + 1]; ++ii) {
+        const Transition &t1 = transitions[inTransition[ii]];
+        for (int ff = outOffset[m]; ff < outOffset[m + 1]; ++ff) {
+          const Transition &t2 = transitions[outTransition[ff]];
+          GammaCascade &cascade = cascades[cascadeOffset[m] + (ii - inOffset[m]) * nOut + (ff - outOffset[m])];
+
+          try {
+            cascade.ak = correlation::CaluclateGammaCoefficient_a(std::abs(levelSpins[inLevel[ii]]), std::abs(levelSpins[m]), std::abs(levelSpins[outLevel[ff]]),
+                                                                  t1.multipolarities, t1.mixingRatio, t2.multipolarities, t2.mixingRatio);
+          }
+          catch (const std::runtime_error &e) {
+            // spins not usable (unknown or not half-integer), isotropic emission
+            cascade.ak = std::vector<double>(1, 1.);
+          }
+          cascade.cdfTable = correlation::GammaGammaInverseCDFTable(cascade.ak);
+        }
+      }
+    }
+  }
+
+  int GammaCascadeTable::FindLevel(double energy) const {
+    std::vector<double>::const_iterator it = std::lower_bound(levelEnergies.begin(), levelEnergies.end(), energy);
+    int index = -1;
+    double best = LevelTolerance;
+    if (it != levelEnergies.end() && std::abs(*it - energy) <= best) {
+      index = it - levelEnergies.begin();
+      best = std::abs(*it - energy);
+    }
+    if (it != levelEnergies.begin() && std::abs(*(it - 1) - energy) <= best) {
+      index = (it - 1) - levelEnergies.begin();
+    }
+    return index;
+  }
+
+  const GammaCascade* GammaCascadeTable::GetCascade(double Ei, double Em, double Ef) const {
+    int m = FindLevel(Em);
+    int i = FindLevel(Ei);
+    int f = FindLevel(Ef);
+    if (m < 0 || i < 0 || f < 0 || cascadeOffset.empty())
+      return nullptr;
+
+    int nOut = outOffset[m + 1] - outOffset[m];
+    for (int ii = inOffset[m]; ii < inOffset[m + 1]; ++ii) {
+      if (inLevel[ii] != i)
+        continue;
+      for (int ff = outOffset[m]; ff < outOffset[m + 1]; ++ff) {
+        if (outLevel[ff] == f)
+          return &cascades[cascadeOffset[m] + (ii - inOffset[m]) * nOut + (ff - outOffset[m])];
+      }
+    }
+    return nullptr;
+  }
+}//End of CRADLE namespace
@@ -0,0 +1,90 @@
+#include "CRADLE/Generator.hh"
+
+#include <cmath>
+#include <complex>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace CRADLE {
+
+  namespace {
+    // Unset correlation coefficients are NaN, two unset values are the same option
+    inline bool SameOption(double a, double b) { return a == b || (std::isnan(a) && std::isnan(b)); }
+    inline bool SameOption(const std::complex<double> &a, const std::complex<double> &b) { return SameOption(a.real(), b.real()) && SameOption(a.imag(), b.imag()); }
+    template <class T>
+    inline bool SameOption(const T &a, const T &b) { return a == b; }
+
+    // Options the events depend on; the output options (file, layout, threads, ...) are not used by a Generator
+    bool SameGenerationOptions(const ConfigOptions &a, const ConfigOptions &b) {
+      const NuclearOptions &na = a.nuclear, &nb = b.nuclear;
+      const CouplingConstants &ca = a.couplingConstants, &cb = b.couplingConstants;
+      const BetaDecay &ba = a.betaDecay, &bb = b.betaDecay;
+      const Decay &da = a.decay, &db = b.decay;
+      const EnvOptions &ea = a.envOptions, &eb = b.envOptions;
+      const Filter &fa = a.filter, &fb = b.filter;
+      return SameOption(a.general.Verbosity_file, b.general.Verbosity_file) &&
+             SameOption(na.Name, nb.Name) && SameOption(na.Charge, nb.Charge) && SameOption(na.Nucleons, nb.Nucleons) &&
+             SameOption(na.Energy, nb.Energy) && SameOption(na.WeakMagnetism, nb.WeakMagnetism) && SameOption(na.Alignment, nb.Alignment) &&
+             SameOption(na.PolarisationMag, nb.PolarisationMag) && SameOption(na.PolarisationX, nb.PolarisationX) &&
+             SameOption(na.PolarisationY, nb.PolarisationY) && SameOption(na.PolarisationZ, nb.PolarisationZ) &&
+             SameOption(ca.CS, cb.CS) && SameOption(ca.CSP, cb.CSP) && SameOption(ca.CV, cb.CV) && SameOption(ca.CVP, cb.CVP) &&
+             SameOption(ca.CT, cb.CT) && SameOption(ca.CTP, cb.CTP) && SameOption(ca.CA, cb.CA) && SameOption(ca.CAP, cb.CAP) &&
+             SameOption(ca.iCS, cb.iCS) && SameOption(ca.iCSP, cb.iCSP) && SameOption(ca.iCV, cb.iCV) && SameOption(ca.iCVP, cb.iCVP) &&
+             SameOption(ca.iCT, cb.iCT) && SameOption(ca.iCTP, cb.iCTP) && SameOption(ca.iCA, cb.iCA) && SameOption(ca.iCAP, cb.iCAP) &&
+             SameOption(ca.b, cb.b) && SameOption(ca.a, cb.a) && SameOption(ca.A, cb.A) &&
+             SameOption(ca.B, cb.B) && SameOption(ca.D, cb.D) && SameOption(ca.c, cb.c) &&
+             SameOption(a.cuts.Distance, b.cuts.Distance) && SameOption(a.cuts.Lifetime, b.cuts.Lifetime) && SameOption(a.cuts.Energy, b.cuts.Energy) &&
+             SameOption(ba.Default, bb.Default) && SameOption(ba.FermiFunction, bb.FermiFunction) &&
+             SameOption(ba.BetaSpectrumCorrections, bb.BetaSpectrumCorrections) && SameOption(ba.SpectrumCorrections, bb.SpectrumCorrections) &&
+             SameOption(ba.RadiativeCorrections, bb.RadiativeCorrections) && SameOption(ba.Cs, bb.Cs) &&
+             SameOption(da.InFlightDecay, db.InFlightDecay) && SameOption(da.NuclearLevelWidth, db.NuclearLevelWidth) &&
+             SameOption(da.GammaGammaCorrelation, db.GammaGammaCorrelation) && SameOption(da.Bias, db.Bias) && SameOption(da.ForcePath, db.ForcePath) &&
+             SameOption(ea.AMEdata, eb.AMEdata) && SameOption(ea.Gammadata, eb.Gammadata) &&
+             SameOption(ea.Radiationdata, eb.Radiationdata) && SameOption(ea.BetaMixingRatios, eb.BetaMixingRatios) &&
+             SameOption(fa.Particles, fb.Particles) && SameOption(fa.EnergyMin, fb.EnergyMin) && SameOption(fa.EnergyMax, fb.EnergyMax) &&
+             SameOption(fa.TimeMin, fb.TimeMin) && SameOption(fa.TimeMax, fb.TimeMax) && SameOption(fa.DirectionX, fb.DirectionX) &&
+             SameOption(fa.DirectionY, fb.DirectionY) && SameOption(fa.DirectionZ, fb.DirectionZ) && SameOption(fa.ConeAngle, fb.ConeAngle);
+    }
+  }
+
+  Generator::Generator(const ConfigOptions &configOptions) : decayManager(DecayManager::GetInstance()), verbosity(configOptions.general.Verbosity_file) {
+    // The decay data and the decay plan are set up once per process, the following
+    // Generators must ask for the same events
+    static std::mutex initialisationMutex;
+    static bool initialised = false;
+    static ConfigOptions initialOptions;
+    std::lock_guard<std::mutex> lock(initialisationMutex);
+    if (!initialised) {
+      if (!decayManager.Initialise(configOptions))
+        throw std::runtime_error("Could not initialise CRADLE for " + configOptions.nuclear.Name);
+      decayManager.CompileDecayPlan();
+      initialOptions = configOptions;
+      initialised = true;
+    }
+    else if (!SameGenerationOptions(configOptions, initialOptions))
+      throw std::runtime_error("A Generator already runs with other options, all the Generators of a process share one decay configuration");
+  }
+
+  std::size_t Generator::Handle::Generate(EventRecord *events, std::size_t n) {
+    std::size_t nParticles = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      // Events rejected by the filter are replaced by the next ones, every record holds an event
+      std::size_t eventParticles = 0;
+      int tries = 0;
+      do {
+        if (tries++ == MaxFilterTries)
+          throw std::runtime_error("No event passed the filter in " + std::to_string(MaxFilterTries) + " decays");
+        if (nextEvent == lastEvent) {
+          nextEvent = generator->nextEvent.fetch_add(EventBlock);
+          lastEvent = nextEvent + EventBlock;
+        }
+        events[i].eventNumber = nextEvent++;
+        events[i].particles.Clear();
+        eventParticles = generator->decayManager.GenerateEvent(events[i].eventNumber, generator->verbosity, events[i].particles);
+      } while (eventParticles == 0 && generator->decayManager.IsFiltering());
+      nParticles += eventParticles;
+    }
+    return nParticles;
+  }
+}//End of CRADLE namespace
@@ -7,7 +7,7 @@
 
 namespace CRADLE {
 
-std::default_random_engine Particle::randomGen;
+thread_local std::default_random_engine Particle::randomGen(rand());
 
 Particle::Particle(const std::string& _name, double _mass, int _charge, int _neutrons, double _spin, double _excitationEnergy): name(_name), mass(_mass), charge(_charge), neutrons(_neutrons), spin(_spin), currentExcitationEnergy(_excitationEnergy) {
   //std::cout << "Creating new particle " << name << std::endl;
@@ -37,6 +37,7 @@ Particle::Particle(const Particle& orig) {
   fourMomentum(0) = mass + currentExcitationEnergy;
 
   PDG = orig.PDG;
+  planNode = orig.planNode;
 
   //std::cout << charge << " " << neutrons << std::endl;
 
@@ -55,8 +56,21 @@ double Particle::GetLifetime() const {
   return t;
 }
 
+double Particle::GetLevelWidth() const {
+  for(int i = 0; i < decayChannels.size(); ++i) {
+    // Width of the current excitation state, computed when the channel is loaded
+    if (std::abs(decayChannels[i]->GetParentExcitationEnergy()-currentExcitationEnergy) < LevelEnergyUncertainty) {
+      return decayChannels[i]->GetLevelWidth();
+    }
+  }
+  return 0.;
+}
+
 double Particle::GetDecayTime() {
-  double lifetime = GetLifetime();
+  return GetDecayTime(GetLifetime());
+}
+
+double Particle::GetDecayTime(double lifetime) {
   //std::cout << name << " Lifetime " << lifetime << std::endl;
   if (lifetime!= 1.e46) {
     std::exponential_distribution<double> distribution(1./lifetime);